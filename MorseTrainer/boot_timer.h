@@ -0,0 +1 @@
+../include/boot_timer.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/command_table.h
\ No newline at end of file
@@ -0,0 +1 @@
+../src/commands.cpp
\ No newline at end of file
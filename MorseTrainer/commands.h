@@ -0,0 +1 @@
+../include/commands.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/confusion_matrix.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/event_bus.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/event_log.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/fast_rng.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/input_aligner.h
\ No newline at end of file
@@ -0,0 +1 @@
+../src/journal.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../include/journal.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/log_buffer.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/log_histogram.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/metrics.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/morse_timing.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/prob_store.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/web_assets.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/weighted_sampler.h
\ No newline at end of file
@@ -0,0 +1 @@
+../include/write_behind.h
\ No newline at end of file
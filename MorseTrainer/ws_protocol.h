@@ -0,0 +1 @@
+../include/ws_protocol.h
\ No newline at end of file
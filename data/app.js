@@ -4,6 +4,7 @@
     // --- DOM refs ---
     var profileSelect = document.getElementById('profile-select');
     var speedInput = document.getElementById('speed-input');
+    var charSpeedInput = document.getElementById('char-speed-input');
     var startBtn = document.getElementById('start-btn');
     var stopBtn = document.getElementById('stop-btn');
     var wpmLabel = document.getElementById('wpm-label');
@@ -15,6 +16,8 @@
     var pitchRow = document.getElementById('pitch-row');
     var buzzerActive = document.getElementById('buzzer-active');
     var buzzerLabel = document.getElementById('buzzer-label');
+    var sidetoneCheck = document.getElementById('sidetone-on');
+    var sidetoneLabel = document.getElementById('sidetone-label');
 
     // --- Keyboard layers ---
     var LAYER_ALPHA = [
@@ -93,14 +96,20 @@
     pitchSlider.addEventListener('input', function () {
         var freq = parseInt(pitchSlider.value, 10);
         pitchValue.textContent = freq + ' Hz';
+        setSidetonePitch(freq);
         send({ type: 'command', cmd: 'pitch', freq: freq });
     });
 
     // --- Buzzer type toggle ---
+    // The pitch slider also sets the sidetone, so it shows for either
+    function updatePitchRow() {
+        pitchRow.style.display = (!buzzerActive.checked || sidetoneOn) ? 'flex' : 'none';
+    }
+
     function updateBuzzerUI(active) {
         buzzerActive.checked = active;
         buzzerLabel.textContent = active ? 'Active' : 'Passive';
-        pitchRow.style.display = active ? 'none' : 'flex';
+        updatePitchRow();
     }
 
     buzzerActive.addEventListener('change', function () {
@@ -109,10 +118,264 @@
         send({ type: 'command', cmd: 'buzzer_type', active: active });
     });
 
+    // --- Device clock ---
+    // char_start times are the device's micros(). Probe the round trip now
+    // and then and keep the offset from the fastest recent probe: the
+    // shortest round trip has the least queueing delay folded into it.
+    var CLOCK_PROBES = 8;
+    var CLOCK_BURST = 5;            // quick probes after connecting
+    var CLOCK_INTERVAL_MS = 5000;   // then one per interval
+    var US_WRAP = 4294967296;       // micros() wraps every ~71 minutes
+    var clockSamples = [];
+    var clockOffset = null;         // device ms - performance.now()
+    var clockTimer = null;
+
+    function probeClock() {
+        send({ type: 'command', cmd: 'clock', t: performance.now() });
+    }
+
+    function startClockSync() {
+        var burst = 0;
+        clockSamples = [];
+        clockOffset = null;
+        clearInterval(clockTimer);
+        clockTimer = setInterval(function () {
+            probeClock();
+            if (++burst === CLOCK_BURST) {
+                clearInterval(clockTimer);
+                clockTimer = setInterval(probeClock, CLOCK_INTERVAL_MS);
+            }
+        }, 200);
+    }
+
+    function stopClockSync() {
+        clearInterval(clockTimer);
+        clockTimer = null;
+        clockOffset = null;
+    }
+
+    // Device micros() -> device ms, unwrapped to the copy nearest "now"
+    function deviceMs(us) {
+        if (clockOffset === null) return us / 1000;
+        var est = (performance.now() + clockOffset) * 1000;
+        return (us + Math.round((est - us) / US_WRAP) * US_WRAP) / 1000;
+    }
+
+    function onClock(msg) {
+        var now = performance.now();
+        var rtt = now - msg.t;
+        if (!(rtt >= 0)) return;
+        clockSamples.push({ rtt: rtt, offset: deviceMs(msg.us) - (msg.t + rtt / 2) });
+        if (clockSamples.length > CLOCK_PROBES) clockSamples.shift();
+        var best = clockSamples[0];
+        for (var i = 1; i < clockSamples.length; i++) {
+            if (clockSamples[i].rtt < best.rtt) best = clockSamples[i];
+        }
+        clockOffset = best.offset;
+    }
+
+    // --- Sidetone ---
+    // Replays each char_start element timeline through WebAudio, at the
+    // device start time mapped onto this clock plus a playout delay. The
+    // delay follows the recent worst arrival lag (a jitter buffer), so
+    // frames held up by WiFi still play on time; gain ramps run on the
+    // audio clock, so element lengths are exact to the sample.
+    var SIDETONE_LEVEL = 0.3;
+    var SIDETONE_RAMP = 0.004;      // s, keeps the keying click-free
+    var JITTER_WINDOW = 32;         // characters
+    var JITTER_MARGIN_MS = 20;
+    var JITTER_MIN_MS = 40;
+    var JITTER_MAX_MS = 600;
+    var sidetoneOn = false;
+    var audioCtx = null;
+    var toneOsc = null;
+    var toneGain = null;
+    var arrivalLag = [];
+    var playoutDelay = 150;         // ms
+    var toneFree = 0;               // audio time the next character may start
+
+    function setSidetone(on) {
+        sidetoneOn = on;
+        sidetoneCheck.checked = on;
+        sidetoneLabel.textContent = on ? 'On' : 'Off';
+        updatePitchRow();
+        try { localStorage.setItem('sidetone', on ? '1' : '0'); } catch (e) { /* private mode */ }
+        if (!on) {
+            silenceSidetone(0);
+            return;
+        }
+        if (!audioCtx) {
+            var Ctx = window.AudioContext || window.webkitAudioContext;
+            if (!Ctx) return;
+            audioCtx = new Ctx();
+            toneOsc = audioCtx.createOscillator();
+            toneGain = audioCtx.createGain();
+            toneGain.gain.value = 0;
+            toneOsc.type = 'sine';
+            toneOsc.frequency.value = parseInt(pitchSlider.value, 10);
+            toneOsc.connect(toneGain);
+            toneGain.connect(audioCtx.destination);
+            toneOsc.start();
+        }
+        // Browsers only let audio start from a user gesture
+        if (audioCtx.state === 'suspended') audioCtx.resume();
+    }
+
+    function setSidetonePitch(freq) {
+        if (toneOsc) toneOsc.frequency.setValueAtTime(freq, audioCtx.currentTime);
+    }
+
+    // performance.now() ms -> audio clock s, at the speaker when supported
+    function audioTimeAt(perfMs) {
+        var ts = audioCtx.getOutputTimestamp ? audioCtx.getOutputTimestamp() : null;
+        if (ts && ts.performanceTime) {
+            return ts.contextTime + (perfMs - ts.performanceTime) / 1000;
+        }
+        return audioCtx.currentTime + (perfMs - performance.now()) / 1000;
+    }
+
+    function playCharStart(msg) {
+        if (!sidetoneOn || !audioCtx || clockOffset === null || !msg.pattern) return;
+
+        var startMs = deviceMs(msg.start_us) - clockOffset;
+        arrivalLag.push(performance.now() - startMs);
+        if (arrivalLag.length > JITTER_WINDOW) arrivalLag.shift();
+        var target = Math.max.apply(null, arrivalLag) + JITTER_MARGIN_MS;
+        target = Math.min(JITTER_MAX_MS, Math.max(JITTER_MIN_MS, target));
+        // Grow at once; shrink slowly so the spacing barely moves
+        playoutDelay = target > playoutDelay ? target
+                                             : playoutDelay + (target - playoutDelay) * 0.05;
+
+        var t = audioTimeAt(startMs + playoutDelay);
+        t = Math.max(t, audioCtx.currentTime + 0.005, toneFree);
+
+        var dit = msg.dit_us / 1e6;
+        var g = toneGain.gain;
+        for (var i = 0; i < msg.pattern.length; i++) {
+            var len = msg.pattern.charAt(i) === '-' ? 3 * dit : dit;
+            var ramp = Math.min(SIDETONE_RAMP, len / 4);
+            g.setValueAtTime(0, t);
+            g.linearRampToValueAtTime(SIDETONE_LEVEL, t + ramp);
+            g.setValueAtTime(SIDETONE_LEVEL, t + len - ramp);
+            g.linearRampToValueAtTime(0, t + len);
+            t += len + dit;
+        }
+        toneFree = t;
+    }
+
+    // Drop tones scheduled after the device's "now" (delayMs behind us)
+    function silenceSidetone(delayMs) {
+        if (!audioCtx) return;
+        var t = Math.max(audioTimeAt(performance.now() + delayMs), audioCtx.currentTime);
+        toneGain.gain.cancelScheduledValues(t);
+        toneGain.gain.setValueAtTime(0, t);
+        toneFree = 0;
+    }
+
+    sidetoneCheck.addEventListener('change', function () {
+        setSidetone(sidetoneCheck.checked);
+    });
+
     // --- WebSocket ---
     var ws = null;
     var running = false;
 
+    // Binary event frames (protocol v2, see include/ws_protocol.h),
+    // decoded into the same objects the JSON protocol sends. A frame
+    // holds one or more records back to back; the tag gives the length.
+    var WS_PROTO_VERSION = 2;
+    var DIRECTIONS = ['set', 'up', 'down'];
+    var RECORD_LEN = [0, 8, 8, 5, 6, 5, 14, 5];
+
+    // Resume point across reconnects: the server's boot id and the last
+    // event number seen. While replayed events are coming in (up to
+    // replayUntil) they update state without flashing.
+    var bootId = null;
+    var lastSeq = null;
+    var replayUntil = 0;
+
+    function u16(d, i) { return d.getUint16(i, true); }
+    function u24(d, i) { return d.getUint16(i, true) | (d.getUint8(i + 2) << 16); }
+
+    // Same rendering as morseCodeToString(): ' ' for a word space, '' if unknown
+    function morsePattern(len, bits) {
+        if (len === 0) return ' ';
+        if (len > 6) return '';
+        var s = '';
+        for (var i = len - 1; i >= 0; i--) {
+            s += (bits >> i) & 1 ? '-' : '.';
+        }
+        return s;
+    }
+
+    function decodeFrame(buf) {
+        var msgs = [];
+        var off = 0;
+        while (off < buf.byteLength) {
+            var len = RECORD_LEN[new DataView(buf, off, 1).getUint8(0) & 0x0F];
+            if (!len || off + len > buf.byteLength) break;
+            var msg = decodeRecord(new DataView(buf, off, len));
+            if (msg) msgs.push(msg);
+            off += len;
+        }
+        return msgs;
+    }
+
+    function decodeRecord(d) {
+        var tag = d.getUint8(0);
+        var flags = tag >> 4;
+        switch (tag & 0x0F) {
+            case 0x01:
+                return {
+                    type: 'char_sent',
+                    char: String.fromCharCode(d.getUint8(1)),
+                    pattern: morsePattern(d.getUint8(2), d.getUint8(3)),
+                    queue_dist: d.getUint8(4),
+                    duration_us: u24(d, 5)
+                };
+            case 0x02:
+                var result = {
+                    type: 'result',
+                    correct: (flags & 1) !== 0,
+                    typed: String.fromCharCode(d.getUint8(1)),
+                    expected: String.fromCharCode(d.getUint8(2)),
+                    prob: d.getUint8(3),
+                    latency_avg_ms: u16(d, 6)
+                };
+                if (flags & 2) result.latency_ms = u16(d, 4);
+                return result;
+            case 0x03:
+                return {
+                    type: 'speed_change',
+                    speed: d.getUint8(1),
+                    dit_us: u24(d, 2),
+                    direction: DIRECTIONS[flags & 3] || 'set'
+                };
+            case 0x04:
+                return {
+                    type: 'session',
+                    state: (flags & 1) ? 'started' : 'stopped',
+                    speed: d.getUint8(1),
+                    char_speed: d.getUint8(2),
+                    dit_us: u24(d, 3)
+                };
+            case 0x05:
+                return { type: 'context_lost', speed: d.getUint8(1), dit_us: u24(d, 2) };
+            case 0x06:
+                return {
+                    type: 'char_start',
+                    char: String.fromCharCode(d.getUint8(1)),
+                    pattern: morsePattern(d.getUint8(2), d.getUint8(3)),
+                    start_us: d.getUint32(4, true),
+                    dit_us: u24(d, 8),
+                    gap_us: u24(d, 11)
+                };
+            case 0x07:
+                return { type: 'seq', seq: d.getUint32(1, true) };
+        }
+        return null;
+    }
+
     function connect() {
         if (ws) {
             ws.onclose = null;
@@ -123,14 +386,25 @@
         var host = window.location.hostname || '192.168.4.1';
         var port = window.location.port || '80';
         ws = new WebSocket('ws://' + host + ':' + port + '/ws');
+        ws.binaryType = 'arraybuffer';
 
         ws.onopen = function () {
             setConnected(true);
-            send({ type: 'command', cmd: 'status' });
+            // Ask for binary events (the server keeps sending JSON if it
+            // doesn't speak this version) and to pick up where we left
+            // off; it answers with the missed events or a status snapshot
+            var hello = { type: 'hello', proto: 'bin', version: WS_PROTO_VERSION };
+            if (bootId !== null && lastSeq !== null) {
+                hello.boot = bootId;
+                hello.seq = lastSeq;
+            }
+            send(hello);
+            startClockSync();
         };
 
         ws.onclose = function () {
             setConnected(false);
+            stopClockSync();
             ws = null;
             setTimeout(connect, 2000);
         };
@@ -139,10 +413,17 @@
             ws.close();
         };
 
+        // Events arrive batched: several binary records in one frame, or
+        // a JSON array of event objects
         ws.onmessage = function (event) {
-            var msg;
-            try { msg = JSON.parse(event.data); } catch (e) { return; }
-            handleMessage(msg);
+            var msgs;
+            if (typeof event.data !== 'string') {
+                msgs = decodeFrame(event.data);
+            } else {
+                try { msgs = JSON.parse(event.data); } catch (e) { return; }
+                if (!Array.isArray(msgs)) msgs = [msgs];
+            }
+            for (var i = 0; i < msgs.length; i++) handleMessage(msgs[i]);
         };
     }
 
@@ -160,17 +441,39 @@
 
     // --- Message handling ---
     function handleMessage(msg) {
+        var replaying = lastSeq !== null && lastSeq < replayUntil;
         switch (msg.type) {
+            case 'hello':
+                // msg.seq is the server's latest, not something we've seen
+                bootId = msg.boot;
+                replayUntil = msg.resume === 'replay' ? msg.seq : 0;
+                return;
+
+            case 'seq':
+                break;
+
+            case 'char_start':
+                playCharStart(msg);
+                break;
+
+            case 'clock':
+                onClock(msg);
+                break;
+
             case 'result':
-                flash(msg.correct);
+                if (!replaying) flash(msg.correct);
                 break;
 
             case 'session':
                 if (msg.state === 'started') {
                     setRunning(true);
+                    if (msg.char_speed !== undefined) {
+                        charSpeedInput.value = msg.char_speed;
+                    }
                     updateSpeed(msg.speed || speedInput.value);
                 } else {
                     setRunning(false);
+                    silenceSidetone(playoutDelay);
                 }
                 break;
 
@@ -181,6 +484,9 @@
             case 'status':
                 if (msg.running) setRunning(true);
                 else setRunning(false);
+                if (msg.char_speed !== undefined) {
+                    charSpeedInput.value = msg.char_speed;
+                }
                 updateSpeed(msg.speed);
                 if (msg.profile !== undefined) {
                     profileSelect.value = msg.profile;
@@ -196,9 +502,11 @@
 
             case 'context_lost':
                 updateSpeed(msg.speed);
-                flash(false);
+                if (!replaying) flash(false);
                 break;
         }
+        if (msg.seq !== undefined) lastSeq = msg.seq;
+        if (msg.boot !== undefined) bootId = msg.boot;
     }
 
     // --- Flash feedback ---
@@ -226,14 +534,17 @@
 
     function updateSpeed(speed) {
         speedInput.value = speed;
-        wpmLabel.textContent = speed + ' WPM';
+        var charSpeed = parseInt(charSpeedInput.value, 10);
+        wpmLabel.textContent = speed + ' WPM' +
+            (charSpeed > speed ? ' (' + charSpeed + ' char)' : '');
     }
 
     // --- Buttons ---
     startBtn.addEventListener('click', function () {
         var profile = parseInt(profileSelect.value, 10);
         var speed = parseInt(speedInput.value, 10);
-        send({ type: 'command', cmd: 'start', profile: profile, speed: speed });
+        var charSpeed = parseInt(charSpeedInput.value, 10) || 0;
+        send({ type: 'command', cmd: 'start', profile: profile, speed: speed, char_speed: charSpeed });
     });
 
     stopBtn.addEventListener('click', function () {
@@ -242,5 +553,10 @@
 
     // --- Init ---
     buildKeyboard();
+    try { setSidetone(localStorage.getItem('sidetone') === '1'); } catch (e) { /* private mode */ }
+    // A restored sidetone waits for the first touch to start the audio
+    document.addEventListener('pointerdown', function () {
+        if (audioCtx && audioCtx.state === 'suspended') audioCtx.resume();
+    });
     connect();
 })();
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Startup phase timings for the boot report. setup() marks the end of
+// each phase in turn, so every phase runs from the previous mark; work
+// that finishes later from loop() (WiFi) is added with its own start.
+// Times are micros(); the clock starts at 0 with the core's own init.
+class BootTimer {
+public:
+    static const uint8_t MAX_PHASES = 12;
+
+    struct Phase {
+        const char* name;
+        uint32_t startUs;
+        uint32_t us;
+        bool background;  // ran alongside loop(), not on the boot path
+    };
+
+    // End the current boot-path phase at nowUs
+    void mark(const char* name, uint32_t nowUs) {
+        add(name, _readyUs, nowUs, false);
+        _readyUs = nowUs;
+    }
+
+    // A phase that ran in the background from startUs to nowUs
+    void markSince(const char* name, uint32_t startUs, uint32_t nowUs) {
+        add(name, startUs, nowUs, true);
+    }
+
+    uint8_t count() const { return _count; }
+    const Phase& phase(uint8_t i) const { return _phases[i]; }
+
+    // When the last boot-path phase ended (loop() starts here)
+    uint32_t readyUs() const { return _readyUs; }
+
+private:
+    void add(const char* name, uint32_t startUs, uint32_t nowUs, bool background) {
+        if (_count >= MAX_PHASES) return;
+        Phase& p = _phases[_count++];
+        p.name = name;
+        p.startUs = startUs;
+        p.us = nowUs - startUs;
+        p.background = background;
+    }
+
+    Phase _phases[MAX_PHASES];
+    uint8_t _count = 0;
+    uint32_t _readyUs = 0;
+};
+
+// Startup timings (defined in main.cpp, reported over serial)
+extern BootTimer bootTimer;
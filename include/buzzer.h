@@ -11,4 +11,12 @@ namespace Buzzer {
     int getFrequency();
     void setActive(bool active);
     bool isActive();
+
+    // Interrupt-safe tone control for the morse engine's timer callback.
+    // Uses direct GPIO writes (tone() can't be started from an ISR), so a
+    // passive buzzer needs isrToggle() every halfPeriodCycles() while on.
+    void isrToneOn();
+    void isrToneOff();
+    void isrToggle();
+    uint32_t halfPeriodCycles();
 }
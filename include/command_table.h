@@ -0,0 +1,221 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdlib.h>
+
+// The command set, shared by the serial console ("/speed 30") and the
+// WebSocket ({"type":"command","cmd":"speed","speed":30}). Names resolve
+// through a sorted constexpr table (binary search, checked at compile
+// time); arguments are read by name from either transport through
+// CommandArgs, so the same handler serves both. Nothing here allocates.
+namespace Command {
+
+enum Id : uint8_t {
+    BOOT, BUZZER_TYPE, CLOCK, CONFUSION, DRILL, EVENTS, HELP, LAG, LOG, METRICS,
+    PITCH, PROBS, PROFILE, SPEED, START, STATUS, STOP, TIMING, WIFI, WS_STATS,
+    COUNT,
+    UNKNOWN = 0xFF
+};
+
+// Where a command can be used
+const uint8_t VIA_SERIAL = 0x01;
+const uint8_t VIA_WS     = 0x02;
+const uint8_t VIA_ALL    = VIA_SERIAL | VIA_WS;
+
+struct Entry {
+    const char* name;
+    Id id;
+    uint8_t via;
+    // Argument names, space separated, in the order serial takes them
+    // (WebSocket commands carry them as JSON fields). The last one takes
+    // the rest of the serial line.
+    const char* params;
+};
+
+// Sorted by name
+constexpr Entry TABLE[] = {
+    { "boot",        BOOT,        VIA_SERIAL, "" },
+    { "buzzer_type", BUZZER_TYPE, VIA_ALL,    "active" },
+    { "clock",       CLOCK,       VIA_WS,     "t" },
+    { "confusion",   CONFUSION,   VIA_ALL,    "reset" },
+    { "drill",       DRILL,       VIA_ALL,    "on" },
+    { "events",      EVENTS,      VIA_ALL,    "reset" },
+    { "help",        HELP,        VIA_SERIAL, "" },
+    { "lag",         LAG,         VIA_ALL,    "limit" },
+    { "log",         LOG,         VIA_SERIAL, "level" },
+    { "metrics",     METRICS,     VIA_SERIAL, "" },
+    { "pitch",       PITCH,       VIA_ALL,    "freq" },
+    { "probs",       PROBS,       VIA_ALL,    "" },
+    { "profile",     PROFILE,     VIA_ALL,    "profile" },
+    { "speed",       SPEED,       VIA_ALL,    "speed" },
+    { "start",       START,       VIA_ALL,    "profile speed char_speed" },
+    { "status",      STATUS,      VIA_ALL,    "" },
+    { "stop",        STOP,        VIA_ALL,    "" },
+    { "timing",      TIMING,      VIA_ALL,    "reset" },
+    { "wifi",        WIFI,        VIA_SERIAL, "mode ssid pass" },
+    { "ws_stats",    WS_STATS,    VIA_WS,     "reset" },
+};
+constexpr uint8_t TABLE_LEN = sizeof(TABLE) / sizeof(TABLE[0]);
+
+constexpr int compare(const char* a, const char* b) {
+    return (*a != *b || !*a) ? (int)(uint8_t)*a - (int)(uint8_t)*b : compare(a + 1, b + 1);
+}
+
+constexpr bool tableSorted(uint8_t i = 1) {
+    return i >= TABLE_LEN || (compare(TABLE[i - 1].name, TABLE[i].name) < 0 && tableSorted(i + 1));
+}
+
+constexpr bool tableComplete(uint8_t i = 0) {
+    return i >= TABLE_LEN || (TABLE[i].id == (Id)i && tableComplete(i + 1));
+}
+
+static_assert(tableSorted(), "Command::TABLE must be sorted by name");
+static_assert(TABLE_LEN == COUNT && tableComplete(), "Command::TABLE must list every Id, in Id order");
+
+// Entry for a name of len characters (need not be NUL terminated), or nullptr
+inline const Entry* find(const char* name, size_t len) {
+    uint8_t lo = 0, hi = TABLE_LEN;
+    while (lo < hi) {
+        uint8_t mid = (lo + hi) / 2;
+        int c = strncmp(TABLE[mid].name, name, len);
+        if (c == 0 && TABLE[mid].name[len] != 0) c = 1;  // longer name sorts after
+        if (c == 0) return &TABLE[mid];
+        if (c < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return nullptr;
+}
+
+inline const Entry* find(const char* name) { return find(name, strlen(name)); }
+
+// Position of key among params (0-based), -1 if absent
+inline int8_t paramIndex(const char* params, const char* key) {
+    size_t klen = strlen(key);
+    int8_t i = 0;
+    const char* p = params;
+    while (*p) {
+        const char* end = p;
+        while (*end && *end != ' ') end++;
+        if ((size_t)(end - p) == klen && strncmp(p, key, klen) == 0) return i;
+        i++;
+        p = *end ? end + 1 : end;
+    }
+    return -1;
+}
+
+// Arguments by name, whichever transport they came in on
+class CommandArgs {
+public:
+    virtual ~CommandArgs() {}
+    virtual bool has(const char* key) const = 0;
+    // False if missing or not of the type
+    virtual bool getInt(const char* key, int& out) const = 0;
+    virtual bool getBool(const char* key, bool& out) const = 0;
+    virtual const char* getStr(const char* key) const = 0;  // nullptr if missing
+};
+
+// A command line's arguments, split in place. Serial words map onto
+// params by position; a word equal to its own name reads as true
+// ("/events reset"), as do on/true/1, and off/false/0 as false.
+class LineArgs : public CommandArgs {
+public:
+    static const uint8_t MAX_ARGS = 4;
+
+    // text is modified (NULs at word ends); it must outlive this
+    LineArgs(char* text, const char* params) : _params(params) {
+        uint8_t nParams = 0;
+        for (const char* p = params; *p; p++) {
+            if (p == params || p[-1] == ' ') nParams++;
+        }
+        char* p = text;
+        while (_count < nParams && _count < MAX_ARGS) {
+            while (*p == ' ') p++;
+            if (!*p) break;
+            _args[_count++] = p;
+            if (_count == nParams) {
+                // The last one takes the rest, minus trailing spaces
+                char* end = p + strlen(p);
+                while (end > p && end[-1] == ' ') *--end = 0;
+                break;
+            }
+            while (*p && *p != ' ') p++;
+            if (*p) *p++ = 0;
+        }
+    }
+
+    uint8_t count() const { return _count; }
+
+    bool has(const char* key) const override { return word(key) != nullptr; }
+
+    bool getInt(const char* key, int& out) const override {
+        const char* w = word(key);
+        if (!w || !*w) return false;
+        char* end;
+        long v = strtol(w, &end, 10);
+        if (*end) return false;
+        out = (int)v;
+        return true;
+    }
+
+    bool getBool(const char* key, bool& out) const override {
+        const char* w = word(key);
+        if (!w) return false;
+        if (strcmp(w, key) == 0 || strcmp(w, "on") == 0 || strcmp(w, "true") == 0 ||
+            strcmp(w, "1") == 0) {
+            out = true;
+        } else if (strcmp(w, "off") == 0 || strcmp(w, "false") == 0 || strcmp(w, "0") == 0) {
+            out = false;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    const char* getStr(const char* key) const override { return word(key); }
+
+private:
+    const char* word(const char* key) const {
+        int8_t i = paramIndex(_params, key);
+        return i >= 0 && i < _count ? _args[i] : nullptr;
+    }
+
+    const char* _params;
+    char* _args[MAX_ARGS] = {};
+    uint8_t _count = 0;
+};
+
+// Fixed-capacity input line. Characters past the capacity are dropped
+// and the line is marked overflowed, to be rejected whole.
+template<uint16_t N>
+class LineBuffer {
+public:
+    void push(char c) {
+        if (_len < N) _buf[_len++] = c;
+        else _overflow = true;
+    }
+    // NUL-terminated contents (writable, for in-place parsing)
+    char* c_str() {
+        _buf[_len] = 0;
+        return _buf;
+    }
+    uint16_t length() const { return _len; }
+    bool overflowed() const { return _overflow; }
+    void clear() {
+        _len = 0;
+        _overflow = false;
+    }
+
+private:
+    char _buf[N + 1];
+    uint16_t _len = 0;
+    bool _overflow = false;
+};
+
+// Outcome of a command (commands.h), for the transport to report
+enum Result : uint8_t {
+    DONE,      // changed something
+    SHOW,      // nothing to change: show the current state / the report
+    INVALID    // bad or missing argument
+};
+
+} // namespace Command
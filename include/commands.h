@@ -0,0 +1,20 @@
+#pragma once
+
+#include "command_table.h"
+
+namespace Command {
+
+// Carry out a command, for either transport. Commands that only report
+// (status, probs, ...) and those given no arguments return SHOW; the
+// transport then prints or sends the report in its own format.
+//
+//   start      profile speed char_speed, all optional; clamped to range
+//   speed      MIN_SPEED..MAX_SPEED          profile    0..NUM_PROFILES-1
+//   pitch      MIN_TONE_FREQ..MAX_TONE_FREQ  lag        clamped to 1..MAX_LAG_DIST
+//   buzzer_type, drill                       true/false
+//   events, timing, confusion                reset clears the stats first
+//   log        quiet|results|full (or 0-2): serial event lines
+//   wifi       mode ssid pass; saved at once (a reboot applies it)
+Result run(Id id, const CommandArgs& args);
+
+} // namespace Command
@@ -64,38 +64,82 @@
 
 // --- Buzzer ---
 #define TONE_FREQ       800 // Hz
+#define MIN_TONE_FREQ   300 // Hz, /pitch range
+#define MAX_TONE_FREQ   1200
 #define BUZZER_ACTIVE_DEFAULT true  // true=active (DC), false=passive (PWM tone)
 
-// --- Morse Timing ---
-#define DASH_TICKS      2   // dash length in ticks (counted from 0)
-#define END_TICKS       1   // inter-character gap ticks
-#define SPACE_TICKS     4   // word-space ticks
+// --- Morse Timing (in dit units) ---
+#define DAH_UNITS           3   // dah length
+#define ELEMENT_GAP_UNITS   1   // gap between elements of a character
+#define CHAR_GAP_UNITS      3   // gap after each character
+#define WORD_GAP_UNITS      4   // extra gap sent for a space (3 + 4 = 7)
 
 // --- Training ---
-#define QUEUE_LENGTH    10
+#define QUEUE_LENGTH    64  // power of two, holds TX_LOOKAHEAD + MAX_LAG_DIST + aligner window
 #define GROUP_LENGTH    5
+#define TX_LOOKAHEAD    (GROUP_LENGTH + 1)  // chars queued ahead in the engine
 #define FIRST_CHAR      33  // ASCII '!'
 #define LAST_CHAR       90  // ASCII 'Z'
 #define CHAR_COUNT      (LAST_CHAR - FIRST_CHAR + 1)  // 58 characters
 #define STAT_LENGTH     10  // letters before speed analysis
 #define UP_PROP         20  // probability increase on wrong answer
 #define DOWN_PROP       5   // probability decrease on correct answer
-#define SPEED_INC       2   // WPM increase on zero errors
-#define SPEED_DEC       4   // WPM decrease on errors
+#define SPEED_INC       2   // speed increase on zero errors (chars/min, shown as "WPM")
+#define SPEED_DEC       4   // speed decrease on errors
 #define MIN_SPEED       20
 #define MAX_SPEED       200
 #define DEFAULT_SPEED   25
 #define DEFAULT_PROFILE 1
 #define CONTEXT_LOST_DIST 5 // queue distance triggering context-lost
+#define MAX_LAG_DIST    40  // highest context-lost distance selectable at runtime
+#define LATENCY_EWMA_SHIFT 3   // per-char latency EWMA weight 1/8
+#define LATENCY_SLOW_PCT  200  // p90 latency above this % of a char period -> slow down
+#define LATENCY_HOLD_PCT  100  // p50 latency above this % of a char period -> don't speed up
+#define DRILL_PAIRS     4   // top confused pairs targeted in drill mode
+#define DRILL_MIX       60  // % of drill-mode letters taken from those pairs
+
+// --- Event output ---
+#define EVENT_QUEUE_LENGTH 16  // per-sink event queue (power of two)
+#define EVENT_MAX_SINKS    4
+#define SERIAL_EVENT_BUDGET 4   // events formatted per loop() pass
+#define SERIAL_LOG_BYTES    1024 // formatted serial lines waiting for the UART (power of two)
+#define SERIAL_LOG_LINE_MAX 96   // longest event line
+#define SERIAL_LOG_LEVEL    2    // at boot: 0 quiet, 1 results, 2 full ([TX] trace too)
+#define WEB_EVENT_BUDGET    8   // events broadcast per loop() pass
+#define WS_MAX_CLIENTS      4   // older WebSocket clients are closed beyond this
+#define WS_MAX_PEERS        8   // clients tracked for protocol negotiation
+#define WS_BATCH_WINDOW_MS  30  // events broadcast together within this window
+#define WS_BATCH_MAX_EVENTS 8   // ...or as soon as this many are waiting
+#define WS_EVENT_LOG_LENGTH 64  // broadcast events kept for resuming clients (power of two)
+
+// --- Commands ---
+#define CMD_LINE_MAX    128  // serial input line, longer lines are rejected
+#define WS_MSG_MAX      256  // WebSocket message, larger ones are ignored
+#define WS_PARSE_ARENA  1024 // static JSON parse buffer for WebSocket messages
+
+// --- Metrics ---
+#define METRICS_MAX         48  // registry entries (metrics.h)
 
 // --- WiFi ---
 #define AP_SSID         "MorseTrainer"
 #define AP_PASS         "morsecode"
 #define MDNS_HOST       "morse"
+#define STA_CONNECT_TIMEOUT_MS 15000  // then fall back to AP mode
 
 // --- Storage ---
-#define PROBS_FILE      "/probs.dat"
+#define PROBS_FILE      "/probs.dat"  // before the A/B store; imported once as P0
+#define PROBS_SLOT_A    "/probs_a.bin"
+#define PROBS_SLOT_B    "/probs_b.bin"
 #define CONFIG_FILE     "/config.json"
+#define CONFUSION_FILE  "/confusion.dat"
+#define CONFIG_FLUSH_DELAY_MS 2000  // config changes settle this long before being written
+#define LEARNED_FLUSH_DELAY_MS 2000 // same for saved probabilities and confusions
+#define JOURNAL_FILE        "/journal.dat"
+#define JOURNAL_TOTALS_FILE "/journal_totals.dat"
+#define JOURNAL_BUFFER_BYTES 256     // one flash page of records
+#define JOURNAL_MAX_BYTES   32768    // compacted into per-char totals past this
+#define JOURNAL_FLUSH_DELAY_MS 5000  // a part-filled buffer is written after this quiet time
+#define JOURNAL_COMPACT_RETRY_MS 60000  // wait after a failed compaction before the next try
 
 // --- Number of profiles (P0 = saved, P1-P9 = preset) ---
 #define NUM_PROFILES    10
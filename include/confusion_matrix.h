@@ -0,0 +1,123 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+// Sparse confusion matrix: how often each expected character was answered
+// with a specific wrong one. A dense 58x58 table would cost 3.4 KB of RAM
+// for mostly zeros, so pairs live in a small open-addressed hash table with
+// saturating uint8 counts (3 bytes per pair). When the table fills up all
+// counts are halved, which drops one-off slips and keeps the real weak
+// pairs.
+#define CONFUSION_SLOTS  128  // power of two
+
+class ConfusionMatrix {
+public:
+    static_assert((CONFUSION_SLOTS & (CONFUSION_SLOTS - 1)) == 0, "CONFUSION_SLOTS must be a power of two");
+
+    struct Entry {
+        char expected;
+        char typed;
+        uint8_t count;   // 0 = empty slot
+    };
+
+    static const size_t BYTES = sizeof(Entry) * CONFUSION_SLOTS;
+
+    void clear() {
+        memset(_slots, 0, sizeof(_slots));
+        _used = 0;
+    }
+
+    // Count one wrong answer. Same-character and out-of-range pairs are
+    // ignored. O(1) expected.
+    void record(char expected, char typed) {
+        if (!inRange(expected) || !inRange(typed) || expected == typed) return;
+        Entry* e = &_slots[find(expected, typed)];
+        if (e->count == 0) {
+            if (_used >= MAX_USED) {
+                age();
+                e = &_slots[find(expected, typed)];
+            }
+            e->expected = expected;
+            e->typed = typed;
+            _used++;
+        }
+        if (e->count < 255) e->count++;
+    }
+
+    uint8_t count(char expected, char typed) const {
+        if (!inRange(expected) || !inRange(typed)) return 0;
+        return _slots[find(expected, typed)].count;
+    }
+
+    // Number of distinct pairs tracked
+    uint8_t size() const { return _used; }
+
+    // Copy up to max pairs into out, highest count first. Returns how many.
+    uint8_t top(Entry* out, uint8_t max) const {
+        uint8_t n = 0;
+        for (uint16_t i = 0; i < CONFUSION_SLOTS; i++) {
+            const Entry& e = _slots[i];
+            if (e.count == 0) continue;
+            // Insertion into the short sorted output list
+            uint8_t pos = n;
+            while (pos > 0 && out[pos - 1].count < e.count) pos--;
+            if (pos >= max) continue;
+            if (n < max) n++;
+            for (uint8_t j = n - 1; j > pos; j--) out[j] = out[j - 1];
+            out[pos] = e;
+        }
+        return n;
+    }
+
+    // Raw slots for persistence (BYTES long)
+    const Entry* raw() const { return _slots; }
+
+    // Rebuild from a persisted slot array, skipping anything invalid
+    void load(const Entry* raw) {
+        clear();
+        for (uint16_t i = 0; i < CONFUSION_SLOTS; i++) {
+            insert(raw[i]);
+        }
+    }
+
+private:
+    static const uint8_t MAX_USED = CONFUSION_SLOTS * 3 / 4;
+
+    Entry _slots[CONFUSION_SLOTS] = {};
+    uint8_t _used = 0;
+
+    static bool inRange(char ch) {
+        return ch >= FIRST_CHAR && ch <= LAST_CHAR;
+    }
+
+    // Slot holding the pair, or the empty slot where it would go.
+    // At least one slot is always left empty, so the probe terminates.
+    uint16_t find(char expected, char typed) const {
+        uint16_t i = ((uint8_t)expected * 67u + (uint8_t)typed) & (CONFUSION_SLOTS - 1);
+        while (_slots[i].count != 0 &&
+               (_slots[i].expected != expected || _slots[i].typed != typed)) {
+            i = (i + 1) & (CONFUSION_SLOTS - 1);
+        }
+        return i;
+    }
+
+    void insert(const Entry& src) {
+        if (src.count == 0 || _used >= CONFUSION_SLOTS - 1) return;
+        if (!inRange(src.expected) || !inRange(src.typed) || src.expected == src.typed) return;
+        Entry& e = _slots[find(src.expected, src.typed)];
+        if (e.count == 0) _used++;
+        e = src;
+    }
+
+    // Halve every count and rehash the survivors
+    void age() {
+        Entry old[CONFUSION_SLOTS];
+        memcpy(old, _slots, sizeof(old));
+        clear();
+        for (uint16_t i = 0; i < CONFUSION_SLOTS; i++) {
+            old[i].count >>= 1;
+            insert(old[i]);
+        }
+    }
+};
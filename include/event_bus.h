@@ -0,0 +1,128 @@
+#pragma once
+
+#include <Arduino.h>
+#include "ring_buffer.h"
+
+// Fan-out queue between event producers and slow output sinks.
+// publish() copies the event into each sink's own RingBuffer and returns;
+// drain() (from loop()) hands each sink at most its budget of events per
+// pass, and only while its ready() check passes, so a sink that can't
+// keep up backs up or loses events on its own queue without ever holding
+// up the producer or the other sinks.
+//
+// Event must be trivially copyable with a `type` member below
+// Event::TYPE_COUNT (used for coalescing).
+template<typename Event, uint16_t DEPTH, uint8_t MAX_SINKS>
+class EventBus {
+public:
+    using Handler = void (*)(const Event& evt);
+    using ReadyFn = bool (*)();
+
+    enum Policy : uint8_t {
+        DROP_OLDEST,  // full queue: discard the oldest undelivered event
+        DROP_NEWEST,  // full queue: discard the event being published
+        COALESCE      // deliver only the latest event of each type (state
+                      // sinks); full queue drops the oldest
+    };
+
+    struct Stats {
+        uint16_t depth;      // events waiting now
+        uint16_t maxDepth;   // high-water mark
+        uint32_t delivered;
+        uint32_t dropped;    // lost to a full queue
+        uint32_t coalesced;  // skipped, superseded by a later one
+    };
+
+    // Register a sink; returns its index or -1 if MAX_SINKS are taken.
+    // budget = max events delivered per drain() (0 = all queued).
+    int8_t addSink(const char* name, Handler handler, Policy policy,
+                   uint8_t budget = 0, ReadyFn ready = nullptr) {
+        if (_count >= MAX_SINKS || !handler) return -1;
+        Sink& s = _sinks[_count];
+        s.name = name;
+        s.handler = handler;
+        s.ready = ready;
+        s.policy = policy;
+        s.budget = budget;
+        s.queue.reset();
+        memset(&s.stats, 0, sizeof(s.stats));
+        return (int8_t)_count++;
+    }
+
+    // O(sinks): never blocks, never calls a handler
+    void publish(const Event& evt) {
+        for (uint8_t i = 0; i < _count; i++) {
+            Sink& s = _sinks[i];
+            if (s.queue.full()) {
+                s.stats.dropped++;
+                if (s.policy == DROP_NEWEST) continue;
+                s.queue.skip();
+            }
+            if (s.policy == COALESCE && evt.type < Event::TYPE_COUNT) {
+                s.latest[evt.type] = s.queue.head();
+            }
+            s.queue.push(evt);
+            if (s.queue.size() > s.stats.maxDepth) s.stats.maxDepth = s.queue.size();
+        }
+    }
+
+    // Deliver queued events, each sink within its budget
+    void drain() {
+        for (uint8_t i = 0; i < _count; i++) {
+            Sink& s = _sinks[i];
+            uint16_t n = s.budget ? s.budget : DEPTH;
+            while (n > 0 && !s.queue.empty()) {
+                if (s.ready && !s.ready()) break;
+                uint16_t seq = s.queue.tail();
+                Event evt;
+                s.queue.pop(evt);
+                if (s.policy == COALESCE && evt.type < Event::TYPE_COUNT &&
+                    s.latest[evt.type] != seq) {
+                    s.stats.coalesced++;
+                    continue;
+                }
+                s.handler(evt);
+                s.stats.delivered++;
+                n--;
+            }
+        }
+    }
+
+    uint8_t sinkCount() const { return _count; }
+
+    const char* sinkName(uint8_t i) const {
+        return i < _count ? _sinks[i].name : nullptr;
+    }
+
+    Stats stats(uint8_t i) const {
+        Stats st = {};
+        if (i >= _count) return st;
+        st = _sinks[i].stats;
+        st.depth = _sinks[i].queue.size();
+        return st;
+    }
+
+    // Zero the counters (queued events are kept)
+    void resetStats() {
+        for (uint8_t i = 0; i < _count; i++) {
+            Sink& s = _sinks[i];
+            memset(&s.stats, 0, sizeof(s.stats));
+            s.stats.maxDepth = s.queue.size();
+        }
+    }
+
+private:
+    struct Sink {
+        const char* name;
+        Handler handler;
+        ReadyFn ready;
+        Policy policy;
+        uint8_t budget;
+        Stats stats;
+        uint16_t latest[Event::TYPE_COUNT];  // COALESCE: seq of newest per type
+        RingBuffer<Event, DEPTH> queue;
+    };
+
+    Sink _sinks[MAX_SINKS];
+    uint8_t _count = 0;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Arduino.h>
+#include "ring_buffer.h"
+
+// The last N events, numbered 1, 2, 3, ... in append order. Lets a
+// consumer that knows the last sequence number it saw pick up exactly
+// where it left off, as long as that point has not been overwritten.
+// Sequence numbers are 32-bit and never reused while the device is up.
+template<typename T, uint16_t N>
+class EventLog {
+public:
+    // Store an event, overwriting the oldest if full; returns its number
+    uint32_t append(const T& v) {
+        if (_ring.full()) _ring.skip();
+        _ring.push(v);
+        return _next++;
+    }
+
+    // Newest stored number (0 = nothing appended yet)
+    uint32_t lastSeq() const { return _next - 1; }
+
+    // Oldest number still held (lastSeq() + 1 when empty)
+    uint32_t firstSeq() const { return _next - _ring.size(); }
+
+    uint16_t size() const { return _ring.size(); }
+
+    bool contains(uint32_t seq) const {
+        return seq >= firstSeq() && seq <= lastSeq();
+    }
+
+    // Can a consumer that has seen up to `seq` be brought up to date
+    // from the log alone (nothing it missed has been overwritten)?
+    bool canResumeAfter(uint32_t seq) const {
+        return seq <= lastSeq() && (seq == lastSeq() || contains(seq + 1));
+    }
+
+    // Event by number; contains(seq) must hold
+    const T& get(uint32_t seq) const {
+        return _ring.at((uint16_t)(_ring.head() - (uint16_t)(_next - seq)));
+    }
+
+    // Forget the stored events; numbering carries on
+    void clear() { _ring.clear(); }
+
+private:
+    RingBuffer<T, N> _ring;
+    uint32_t _next = 1;
+};
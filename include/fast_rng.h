@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Small seedable PRNG (xorshift32) for training draws. Much cheaper than
+// Arduino random() and reproducible from a seed, which the native tests
+// rely on. Not for anything security-related.
+class FastRng {
+public:
+    explicit FastRng(uint32_t seed = 0x9E3779B9UL) { this->seed(seed); }
+
+    void seed(uint32_t s) {
+        // Zero is a fixed point of xorshift
+        _state = s ? s : 0x9E3779B9UL;
+    }
+
+    uint32_t next() {
+        uint32_t x = _state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        _state = x;
+        return x;
+    }
+
+    // Uniform in [0, n) by multiply-shift (no division). n = 0 returns 0.
+    uint32_t below(uint32_t n) {
+        return (uint32_t)(((uint64_t)next() * n) >> 32);
+    }
+
+private:
+    uint32_t _state;
+};
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Banded edit-distance alignment of typed input against sent characters.
+// The trainer keeps the last few typed characters and the sent characters
+// from the point they started at, and re-aligns them on every keypress so
+// a dropped, doubled or extra character costs one error instead of
+// shifting every answer that follows.
+namespace InputAligner {
+
+const uint8_t MAX_TYPED = 6;    // typed window, including the new char
+const uint8_t MAX_SENT  = 12;   // sent characters considered
+const uint8_t BAND      = 3;    // max drift between typed and sent positions
+const int8_t  EXTRA     = -1;   // pos[] value for a typed char matching nothing
+
+// Align typed[0..nTyped) against a prefix of sent[0..nSent): every typed
+// char is consumed, sent chars past the last aligned one are free (not
+// answered yet). Match costs 0; substitution, missed sent char and extra
+// typed char cost 1 each. For each typed char pos[] receives the sent
+// index it lines up with, or EXTRA. Returns the alignment cost.
+//
+// Ties go to the reading the old single-step matcher would pick: the new
+// char matching exactly, then substituting for a sent char, then the
+// shortest sent prefix.
+inline uint8_t align(const char* sent, uint8_t nSent,
+                     const char* typed, uint8_t nTyped, int8_t* pos) {
+    if (nSent > MAX_SENT) nSent = MAX_SENT;
+    if (nTyped > MAX_TYPED) nTyped = MAX_TYPED;
+    const uint8_t INF = 0xFF;
+
+    // d[i][j]: cost of typed[0..i) against sent[0..j)
+    uint8_t d[MAX_TYPED + 1][MAX_SENT + 1];
+    for (uint8_t i = 0; i <= nTyped; i++) {
+        for (uint8_t j = 0; j <= nSent; j++) {
+            int drift = (int)j - (int)i;
+            if (drift > BAND || drift < -BAND) {
+                d[i][j] = INF;
+                continue;
+            }
+            if (i == 0) { d[i][j] = j; continue; }
+            if (j == 0) { d[i][j] = i; continue; }
+            uint8_t best = INF;
+            uint8_t diag = d[i - 1][j - 1];
+            if (diag != INF) best = diag + (typed[i - 1] == sent[j - 1] ? 0 : 1);
+            uint8_t extra = d[i - 1][j];     // typed char matches nothing
+            if (extra != INF && extra + 1 < best) best = extra + 1;
+            uint8_t missed = d[i][j - 1];    // sent char never typed
+            if (missed != INF && missed + 1 < best) best = missed + 1;
+            d[i][j] = best;
+        }
+    }
+
+    // Pick where the typed text ends in the sent text. Rank: cost, then
+    // last char an exact match, then last char lined up with a sent char
+    // at all, then the shorter prefix.
+    uint8_t endJ = 0;
+    uint8_t bestRank = 0;
+    uint8_t bestCost = INF;
+    for (uint8_t j = 0; j <= nSent; j++) {
+        uint8_t c = d[nTyped][j];
+        if (c == INF) continue;
+        uint8_t rank = 0;
+        if (nTyped > 0 && j > 0 && d[nTyped - 1][j - 1] != INF) {
+            bool same = typed[nTyped - 1] == sent[j - 1];
+            if (d[nTyped - 1][j - 1] + (same ? 0 : 1) == c) rank = same ? 2 : 1;
+        }
+        if (c < bestCost || (c == bestCost && rank > bestRank)) {
+            bestCost = c;
+            bestRank = rank;
+            endJ = j;
+        }
+    }
+
+    // Trace back. The last char follows the end choice above; earlier
+    // ties go to "extra" so that of two identical keystrokes the earlier
+    // one keeps its match.
+    uint8_t i = nTyped, j = endJ;
+    while (i > 0) {
+        uint8_t c = d[i][j];
+        bool diag = j > 0 && d[i - 1][j - 1] != INF &&
+                    d[i - 1][j - 1] + (typed[i - 1] == sent[j - 1] ? 0 : 1) == c;
+        bool extra = d[i - 1][j] != INF && d[i - 1][j] + 1 == c;
+        if (diag && (!extra || (i == nTyped && bestRank > 0))) {
+            pos[--i] = (int8_t)(--j);
+        } else if (extra) {
+            pos[--i] = EXTRA;
+        } else {
+            j--;
+        }
+    }
+    return bestCost;
+}
+
+// What receiving does for a keystroke aligned with sent index p, with
+// the receive point at sent index recv
+struct Step {
+    uint16_t missed;   // sent chars passed over unanswered (bit per index)
+    bool score;        // score the keystroke against sent[p]
+};
+
+// scored has a bit per sent index that already has a result, and is
+// updated. A char is never scored twice: when re-alignment steps back
+// over a keystroke now read as extra, the result that keystroke was
+// given stands, and the sent char it was scored against is not scored
+// again. Nothing to do for EXTRA.
+inline Step step(int8_t p, uint8_t recv, uint16_t& scored) {
+    Step s = { 0, false };
+    if (p == EXTRA) return s;
+    for (uint8_t i = recv; i < (uint8_t)p; i++) {
+        if (!(scored & (1u << i))) s.missed |= (uint16_t)(1u << i);
+    }
+    s.score = !(scored & (1u << p));
+    scored |= (uint16_t)(s.missed | (1u << p));
+    return s;
+}
+
+static_assert(MAX_SENT <= 16, "step() keeps a bit per sent char");
+
+} // namespace InputAligner
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "config.h"
+
+struct TrainerEvent;
+class Print;
+
+// Per-character history on the device. Every scored character is
+// appended to JOURNAL_FILE as a fixed 8-byte record, through a RAM
+// buffer written out a flash page (JOURNAL_BUFFER_BYTES) at a time.
+// Past JOURNAL_MAX_BYTES the journal is compacted: its records are
+// folded into per-character totals in JOURNAL_TOTALS_FILE and it starts
+// again empty. Both are exported as CSV over HTTP, streamed from the
+// files rather than loaded whole.
+//
+// Record layout (little endian):
+//   0  flags         0x01 correct, 0x02 latency measured, 0x04 session start
+//   1  expected      ASCII
+//   2  typed         ASCII
+//   3  speed         chars/min (the "WPM" setting)
+//   4  dt u16        ms since the previous record (or the session start)
+//   6  latency u16   ms
+// Both u16 fields saturate at 65535.
+namespace Journal {
+
+const uint8_t RECORD_LEN = 8;
+
+const uint8_t FLAG_CORRECT = 0x01;
+const uint8_t FLAG_LATENCY = 0x02;
+const uint8_t FLAG_SESSION = 0x04;
+
+static_assert(JOURNAL_BUFFER_BYTES % RECORD_LEN == 0, "buffer holds whole records");
+
+struct Record {
+    uint8_t flags;
+    char expected;
+    char typed;
+    uint8_t speed;
+    uint16_t dtMs;
+    uint16_t latencyMs;
+};
+
+inline uint16_t sat16(uint32_t v) { return v > 0xFFFF ? 0xFFFF : (uint16_t)v; }
+
+inline void encode(const Record& r, uint8_t* out) {
+    out[0] = r.flags;
+    out[1] = (uint8_t)r.expected;
+    out[2] = (uint8_t)r.typed;
+    out[3] = r.speed;
+    out[4] = (uint8_t)r.dtMs;
+    out[5] = (uint8_t)(r.dtMs >> 8);
+    out[6] = (uint8_t)r.latencyMs;
+    out[7] = (uint8_t)(r.latencyMs >> 8);
+}
+
+inline Record decode(const uint8_t* in) {
+    Record r;
+    r.flags = in[0];
+    r.expected = (char)in[1];
+    r.typed = (char)in[2];
+    r.speed = in[3];
+    r.dtMs = (uint16_t)(in[4] | (in[5] << 8));
+    r.latencyMs = (uint16_t)(in[6] | (in[7] << 8));
+    return r;
+}
+
+// Compacted history of one expected character
+struct CharTotals {
+    uint32_t attempts;
+    uint32_t correct;
+    uint32_t latencySumMs;   // over attempts with a measured latency
+    uint32_t latencyCount;
+};
+
+inline void fold(CharTotals totals[CHAR_COUNT], const Record& r) {
+    if (r.expected < FIRST_CHAR || r.expected > LAST_CHAR) return;
+    CharTotals& t = totals[r.expected - FIRST_CHAR];
+    t.attempts++;
+    if (r.flags & FLAG_CORRECT) t.correct++;
+    if (r.flags & FLAG_LATENCY) {
+        t.latencySumMs += r.latencyMs;
+        t.latencyCount++;
+    }
+}
+
+const char CSV_HEADER[] = "session,t_ms,expected,typed,correct,speed_wpm,latency_ms\n";
+const char TOTALS_CSV_HEADER[] = "char,attempts,correct,latency_avg_ms\n";
+const uint8_t CSV_LINE_MAX = 64;
+
+// A character as a CSV field: quoted if it's a comma or quote, empty if
+// it isn't printable. buf holds 5 bytes.
+inline const char* csvChar(char c, char* buf) {
+    char* p = buf;
+    if (c == ',' || c == '"') {
+        *p++ = '"';
+        *p++ = c;
+        if (c == '"') *p++ = '"';
+        *p++ = '"';
+    } else if (c > ' ' && c < 127) {
+        *p++ = c;
+    }
+    *p = 0;
+    return buf;
+}
+
+// Turns records, in journal order, into CSV lines: numbers the sessions
+// and adds up the deltas into a time within each session
+class CsvWriter {
+public:
+    // Returns the line length, 0 if it doesn't fit in len (the record
+    // is then not consumed). Latency is empty when it wasn't measured.
+    int line(const Record& r, char* out, size_t len) {
+        uint32_t session = _session;
+        uint32_t tMs = _tMs;
+        if ((r.flags & FLAG_SESSION) || session == 0) {
+            session++;
+            tMs = 0;
+        }
+        tMs += r.dtMs;
+        char e[5], t[5], lat[6] = "";
+        if (r.flags & FLAG_LATENCY) snprintf(lat, sizeof(lat), "%u", r.latencyMs);
+        // Formatted whole first (every field is bounded, so it always
+        // fits), then copied only if out has room: a short out is the
+        // normal end of a chunk, not a truncated line
+        char line[CSV_LINE_MAX];
+        int n = snprintf(line, sizeof(line), "%lu,%lu,%s,%s,%d,%u,%s\n",
+                         (unsigned long)session, (unsigned long)tMs,
+                         csvChar(r.expected, e), csvChar(r.typed, t),
+                         (r.flags & FLAG_CORRECT) ? 1 : 0, r.speed, lat);
+        if (n <= 0 || (size_t)n >= sizeof(line) || (size_t)n >= len) return 0;
+        memcpy(out, line, n + 1);
+        _session = session;
+        _tMs = tMs;
+        return n;
+    }
+
+private:
+    uint32_t _session = 0;
+    uint32_t _tMs = 0;
+};
+
+// --- On the device (journal.cpp) ---
+
+void begin();
+void onTrainerEvent(const TrainerEvent& evt);  // event bus sink
+
+// Call from loop(): writes the buffer once it holds a full page, and a
+// part-filled one or a due compaction only when idle
+void update(bool idle);
+
+// Streams the journal as CSV, one per HTTP response. Reads the file a
+// chunk at a time, then the records still in the RAM buffer.
+class Export {
+public:
+    Export();
+    ~Export();
+    // Fill buf with whole lines; 0 once everything has been sent
+    size_t read(uint8_t* buf, size_t len);
+
+private:
+    uint32_t _pos = 0;        // journal bytes turned into CSV so far
+    uint32_t _generation;     // compaction count when the export began
+    bool _header = false;
+    CsvWriter _csv;
+};
+
+// Per-character totals over everything recorded: the compacted history
+// plus the journal
+void writeTotalsCsv(Print& out);
+
+struct Stats {
+    uint32_t records;       // appended since boot
+    uint32_t dropped;       // lost: journal at twice its cap, or a write failed
+    uint32_t pageWrites;    // buffer flushes
+    uint32_t compactions;
+    uint32_t compactFailures;  // each retried after JOURNAL_COMPACT_RETRY_MS
+    uint32_t fileBytes;     // JOURNAL_FILE size, buffer included
+    uint32_t lastWriteUs;
+    uint32_t lastCompactUs;
+};
+Stats stats();
+
+} // namespace Journal
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// Formatted text lines waiting for a slow output (the serial port).
+// Producers format a line into the buffer and return at once; drain()
+// writes out whole lines, only as many as the output says it has room
+// for, so neither side ever waits on the UART. A line that doesn't fit
+// is dropped whole and counted, never cut short. N is a power of two;
+// positions are free-running like RingBuffer's.
+template<uint16_t N, uint8_t LINE_MAX = 96>
+class LogBuffer {
+public:
+    static_assert(N > 0 && (N & (N - 1)) == 0, "LogBuffer size must be a power of two");
+    static_assert(N <= 0x8000, "LogBuffer size must fit a 16-bit distance");
+    static_assert(N >= 2 * LINE_MAX, "LogBuffer must hold a couple of lines");
+
+    struct Stats {
+        uint32_t lines;      // appended
+        uint32_t dropped;    // lines lost to a full buffer
+        uint32_t bytes;      // written out
+        uint16_t maxUsed;    // high-water mark
+    };
+
+    uint16_t used() const { return (uint16_t)(_head - _tail); }
+    uint16_t free() const { return N - used(); }
+    bool empty() const { return _head == _tail; }
+
+    // Append one line, formatted; longer than LINE_MAX is truncated, and
+    // a missing newline is added. False if dropped.
+    bool appendf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        va_list ap;
+        va_start(ap, fmt);
+        bool ok = vappendf(fmt, ap);
+        va_end(ap);
+        return ok;
+    }
+
+    bool vappendf(const char* fmt, va_list ap) {
+        char line[LINE_MAX + 1];
+        int n = vsnprintf(line, sizeof(line), fmt, ap);
+        if (n < 0) return false;
+        if (n > LINE_MAX) n = LINE_MAX;
+        if (n == 0 || line[n - 1] != '\n') {
+            if (n == LINE_MAX) n--;
+            line[n++] = '\n';
+        }
+        return append(line, (uint16_t)n);
+    }
+
+    // Append raw text ending in a newline, all or nothing
+    bool append(const char* text, uint16_t len) {
+        if (len > free()) {
+            _stats.dropped++;
+            return false;
+        }
+        for (uint16_t i = 0; i < len; i++) _buf[(uint16_t)(_head + i) & (N - 1)] = text[i];
+        _head += len;
+        _stats.lines++;
+        if (used() > _stats.maxUsed) _stats.maxUsed = used();
+        return true;
+    }
+
+    // Write whole lines, at most room bytes, to out (anything with
+    // write(const uint8_t*, size_t)). Returns the bytes written.
+    template<typename Out>
+    size_t drain(Out& out, size_t room) {
+        uint16_t n = used() < room ? used() : (uint16_t)room;
+        while (n > 0 && _buf[(uint16_t)(_tail + n - 1) & (N - 1)] != '\n') n--;
+        if (n == 0) return 0;
+        uint16_t start = _tail & (N - 1);
+        uint16_t first = N - start < n ? N - start : n;
+        out.write(_buf + start, first);
+        if (first < n) out.write(_buf, n - first);
+        _tail += n;
+        _stats.bytes += n;
+        return n;
+    }
+
+    void clear() { _tail = _head; }
+    const Stats& stats() const { return _stats; }
+    void resetStats() { _stats = Stats(); }
+
+private:
+    uint8_t _buf[N];
+    uint16_t _head = 0;
+    uint16_t _tail = 0;
+    Stats _stats = {};
+};
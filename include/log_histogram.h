@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Log2-bucketed histogram for non-negative integer samples.
+// Bucket 0 holds zeros, bucket k (1-32) holds values in [2^(k-1), 2^k).
+// Fixed size (no allocation); percentiles resolve to a bucket's upper bound.
+class LogHistogram {
+public:
+    static const uint8_t BUCKETS = 33;
+
+    void reset() {
+        memset(_counts, 0, sizeof(_counts));
+        _count = 0;
+        _max = 0;
+        _sum = 0;
+    }
+
+    void record(uint32_t v) {
+        _counts[bucketOf(v)]++;
+        _count++;
+        _sum += v;
+        if (v > _max) _max = v;
+    }
+
+    uint32_t count() const { return _count; }
+    uint32_t max() const { return _max; }
+    uint64_t sum() const { return _sum; }
+    uint32_t mean() const { return _count ? (uint32_t)(_sum / _count) : 0; }
+    uint32_t bucketCount(uint8_t i) const { return i < BUCKETS ? _counts[i] : 0; }
+
+    static uint8_t bucketOf(uint32_t v) {
+        return v == 0 ? 0 : (uint8_t)(32 - __builtin_clz(v));
+    }
+
+    // Largest value that falls in bucket i
+    static uint32_t bucketUpper(uint8_t i) {
+        if (i == 0) return 0;
+        if (i >= 32) return 0xFFFFFFFFUL;
+        return (1UL << i) - 1;
+    }
+
+    // Upper bound of the bucket holding the pct-th percentile (0-100),
+    // clamped to the observed maximum. Returns 0 if empty.
+    uint32_t percentile(uint8_t pct) const {
+        if (_count == 0) return 0;
+        if (pct > 100) pct = 100;
+        // Rank of the sample we're after (1-based, rounded up)
+        uint64_t rank = ((uint64_t)_count * pct + 99) / 100;
+        if (rank == 0) rank = 1;
+        uint64_t seen = 0;
+        for (uint8_t i = 0; i < BUCKETS; i++) {
+            seen += _counts[i];
+            if (seen >= rank) {
+                uint32_t upper = bucketUpper(i);
+                return upper < _max ? upper : _max;
+            }
+        }
+        return _max;
+    }
+
+private:
+    uint32_t _counts[BUCKETS] = {};
+    uint32_t _count = 0;
+    uint32_t _max = 0;
+    uint64_t _sum = 0;
+};
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include "config.h"
+#include "log_histogram.h"
+
+// Runtime health metrics: a fixed registry of counters, gauges and log2
+// histograms, rendered in the Prometheus text format (served at /metrics
+// over HTTP and printed by the /metrics serial command).
+//
+// The registry only holds pointers: a metric either lives with the code
+// that updates it (Counter, Gauge, LogHistogram) or is read through a
+// function when rendered, for values kept elsewhere (free heap, queue
+// depths). Entries sharing a name form one family and must be
+// registered one after another, each with its own labels.
+namespace Metrics {
+
+class Counter {
+public:
+    void inc(uint32_t n = 1) { _v += n; }
+    uint32_t value() const { return _v; }
+private:
+    uint32_t _v = 0;
+};
+
+class Gauge {
+public:
+    void set(int32_t v) { _v = v; }
+    int32_t value() const { return _v; }
+private:
+    int32_t _v = 0;
+};
+
+// Per-second rate of a running total, recomputed once a second
+class Rate {
+public:
+    void update(uint32_t nowMs, uint32_t total) {
+        uint32_t dt = nowMs - _lastMs;
+        if (dt < 1000) return;
+        _perSec = (int32_t)((uint64_t)(total - _lastTotal) * 1000 / dt);
+        _lastMs = nowMs;
+        _lastTotal = total;
+    }
+    int32_t value() const { return _perSec; }
+private:
+    uint32_t _lastMs = 0;
+    uint32_t _lastTotal = 0;
+    int32_t _perSec = 0;
+};
+
+using ReadFn = int32_t (*)();
+
+template<uint8_t MAX>
+class Registry {
+public:
+    enum Kind : uint8_t { COUNTER, GAUGE, HISTOGRAM };
+
+    // Each returns false if the registry is full. labels is the inside
+    // of the braces, e.g. "sink=\"web\"", or nullptr.
+    bool counter(const char* name, const char* help, const Counter* c,
+                 const char* labels = nullptr) {
+        return add(name, help, labels, COUNTER, c, nullptr, nullptr, nullptr);
+    }
+    bool counter(const char* name, const char* help, ReadFn fn,
+                 const char* labels = nullptr) {
+        return add(name, help, labels, COUNTER, nullptr, nullptr, nullptr, fn);
+    }
+    bool gauge(const char* name, const char* help, const Gauge* g,
+               const char* labels = nullptr) {
+        return add(name, help, labels, GAUGE, nullptr, g, nullptr, nullptr);
+    }
+    bool gauge(const char* name, const char* help, ReadFn fn,
+               const char* labels = nullptr) {
+        return add(name, help, labels, GAUGE, nullptr, nullptr, nullptr, fn);
+    }
+    bool histogram(const char* name, const char* help, const LogHistogram* h,
+                   const char* labels = nullptr) {
+        return add(name, help, labels, HISTOGRAM, nullptr, nullptr, h, nullptr);
+    }
+
+    uint8_t size() const { return _count; }
+
+    // Write every metric to out (anything with write(const uint8_t*, size_t):
+    // Serial, an AsyncResponseStream). Histograms list their buckets up to
+    // the highest one in use, then +Inf.
+    template<class Out>
+    void render(Out& out) const {
+        for (uint8_t i = 0; i < _count; i++) {
+            const Entry& e = _entries[i];
+            if (i == 0 || strcmp(e.name, _entries[i - 1].name) != 0) {
+                line(out, "# HELP %s %s\n", e.name, e.help);
+                line(out, "# TYPE %s %s\n", e.name, kindName(e.kind));
+            }
+            const char* lb = e.labels ? e.labels : "";
+            const char* sep = e.labels ? "," : "";
+            switch (e.kind) {
+                case COUNTER: {
+                    uint32_t v = e.fn ? (uint32_t)e.fn() : e.counter->value();
+                    line(out, "%s%s%s%s %lu\n", e.name, e.labels ? "{" : "", lb,
+                         e.labels ? "}" : "", (unsigned long)v);
+                    break;
+                }
+                case GAUGE: {
+                    int32_t v = e.fn ? e.fn() : e.gauge->value();
+                    line(out, "%s%s%s%s %ld\n", e.name, e.labels ? "{" : "", lb,
+                         e.labels ? "}" : "", (long)v);
+                    break;
+                }
+                case HISTOGRAM: {
+                    const LogHistogram& h = *e.hist;
+                    uint8_t top = 0;
+                    for (uint8_t b = 0; b < LogHistogram::BUCKETS; b++) {
+                        if (h.bucketCount(b)) top = b;
+                    }
+                    uint32_t cum = 0;
+                    for (uint8_t b = 0; b <= top && b < LogHistogram::BUCKETS - 1; b++) {
+                        cum += h.bucketCount(b);
+                        line(out, "%s_bucket{%s%sle=\"%lu\"} %lu\n", e.name, lb, sep,
+                             (unsigned long)LogHistogram::bucketUpper(b), (unsigned long)cum);
+                    }
+                    line(out, "%s_bucket{%s%sle=\"+Inf\"} %lu\n", e.name, lb, sep,
+                         (unsigned long)h.count());
+                    char sum[21];
+                    line(out, "%s_sum%s%s%s %s\n", e.name, e.labels ? "{" : "", lb,
+                         e.labels ? "}" : "", u64toa(h.sum(), sum));
+                    line(out, "%s_count%s%s%s %lu\n", e.name, e.labels ? "{" : "", lb,
+                         e.labels ? "}" : "", (unsigned long)h.count());
+                    break;
+                }
+            }
+        }
+    }
+
+private:
+    struct Entry {
+        const char* name;
+        const char* help;
+        const char* labels;
+        Kind kind;
+        const Counter* counter;
+        const Gauge* gauge;
+        const LogHistogram* hist;
+        ReadFn fn;
+    };
+
+    bool add(const char* name, const char* help, const char* labels, Kind kind,
+             const Counter* c, const Gauge* g, const LogHistogram* h, ReadFn fn) {
+        if (_count >= MAX) return false;
+        _entries[_count++] = { name, help, labels, kind, c, g, h, fn };
+        return true;
+    }
+
+    static const char* kindName(Kind k) {
+        return k == COUNTER ? "counter" : k == GAUGE ? "gauge" : "histogram";
+    }
+
+    // printf into a line buffer, then out.write(); long lines are cut
+    template<class Out>
+    static void line(Out& out, const char* fmt, ...) {
+        char buf[160];
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+        va_end(ap);
+        if (n < 0) return;
+        if (n >= (int)sizeof(buf)) n = sizeof(buf) - 1;
+        out.write((const uint8_t*)buf, (size_t)n);
+    }
+
+    // Decimal uint64 without relying on printf's %llu
+    static const char* u64toa(uint64_t v, char* buf) {
+        char* p = buf + 20;
+        *p = 0;
+        do {
+            *--p = (char)('0' + v % 10);
+            v /= 10;
+        } while (v);
+        return p;
+    }
+
+    Entry _entries[MAX];
+    uint8_t _count = 0;
+};
+
+} // namespace Metrics
+
+// Firmware-wide registry (defined in main.cpp)
+using MetricsRegistry = Metrics::Registry<METRICS_MAX>;
+extern MetricsRegistry metrics;
@@ -1,11 +1,26 @@
 #pragma once
 
 #include <Arduino.h>
-#include <Ticker.h>
+#include "morse_table.h"
+#include "morse_timing.h"
+#include "log_histogram.h"
 
-// Callback types for morse engine events
+// Callback types for morse engine events.
+// All are delivered from update() (loop context), never from the timer ISR.
 using MorseElementCB = void (*)(bool on);   // tone on/off
-using MorseCharDoneCB = void (*)(char ch);  // character finished sending
+using MorseCharDoneCB = void (*)(char ch, uint32_t doneUs);  // character finished sending (micros() timestamp)
+
+// A character going on air: its elements (dah = DAH_UNITS dits, one
+// element gap between them) start at startUs, then gapUs of silence.
+// A word space has no elements; gapUs is the silence it adds.
+struct MorseCharStart {
+    char ch;
+    MorseCode code;
+    uint32_t startUs;  // micros() of the first edge (ideal, not ISR-late)
+    uint32_t ditUs;
+    uint32_t gapUs;
+};
+using MorseCharStartCB = void (*)(const MorseCharStart& start);
 
 namespace MorseEngine {
     void begin();
@@ -13,18 +28,45 @@ namespace MorseEngine {
     // Set callbacks for tone events and character-done events
     void onElement(MorseElementCB cb);
     void onCharDone(MorseCharDoneCB cb);
+    void onCharStart(MorseCharStartCB cb);
+
+    // Queue a character for morse transmission. The timer ISR starts each
+    // queued character as soon as the previous one's gap has elapsed.
+    // Returns false if the transmit queue is full.
+    bool sendLetter(char ch);
+
+    // Free slots in the transmit queue
+    uint8_t queueFree();
+    uint8_t queueDepth();  // characters waiting to be sent
 
-    // Queue a character for morse transmission
-    void sendLetter(char ch);
+    // Drop all queued characters. The character already sounding finishes,
+    // but no char-done callback is delivered for it.
+    void flush();
 
-    // Is the engine currently sending?
+    // Is the engine sending, or are characters still queued?
     bool isSending();
 
-    // Set speed in WPM — adjusts ticker interval
-    void setSpeed(int wpm);
+    // Deliver pending element/char-done callbacks. Call from loop().
+    void update();
+
+    // Set character speed ("WPM", i.e. chars/min, morse_timing.h) — applies from the next character.
+    // Durations come from the PARIS model in morse_timing.h.
+    // An effectiveWpm below wpm keeps elements at wpm but stretches the
+    // inter-character and inter-word gaps (Farnsworth); 0 = standard timing.
+    void setSpeed(int wpm, int effectiveWpm = 0);
     int  getSpeed();
+    int  getEffectiveSpeed();
+
+    // Element and gap durations currently in effect (Q8 us)
+    MorseTiming::Timing getTiming();
+
+    // Edge timing: how late each tone on/off edge landed against its ideal
+    // time, in nanoseconds. Samples are folded in by update().
+    const LogHistogram& edgeTiming();
+    uint32_t edgeTimingDropped();   // samples lost because loop() fell behind
+    void resetEdgeTiming();
 
-    // Look up the morse pattern string (dots/dashes) for a character.
-    // Writes to buf (must be >= 7 bytes). Returns pattern length, 0 if not found.
-    int getPattern(char ch, char* buf);
+    // Look up the packed morse code for a character.
+    // Returns a code with len == MORSE_NO_CODE if not found.
+    MorseCode getCode(char ch);
 }
@@ -8,6 +8,45 @@ extern const int morseTreetop;
 extern const int morseTableLength;
 extern const int morseTreeLevels;
 
+#define MORSE_MAX_ELEMENTS  6
+#define MORSE_NO_CODE       0xFF
+
+// Packed morse pattern: element count plus element bits.
+// The first element is the most significant used bit (1 = dah, 0 = dit),
+// so (1 << len) | bits is the node's index in a heap-ordered tree.
+struct MorseCode {
+    uint8_t len;   // number of elements (0 = space), MORSE_NO_CODE if unknown
+    uint8_t bits;  // element bits, LSB = last element
+
+    bool valid() const { return len <= MORSE_MAX_ELEMENTS; }
+    bool isSpace() const { return len == 0; }
+
+    // Element i counted from the first sent (0-based)
+    bool isDah(uint8_t i) const { return (bits >> (len - 1 - i)) & 1; }
+
+    // Append one element; returns false once the code is full
+    bool append(bool dah) {
+        if (len >= MORSE_MAX_ELEMENTS) return false;
+        bits = (uint8_t)((bits << 1) | (dah ? 1 : 0));
+        len++;
+        return true;
+    }
+};
+
+// Look up the packed code for a character (single table load, lowercase
+// maps to uppercase). Space returns the empty code (len 0); unknown
+// characters return len == MORSE_NO_CODE.
+MorseCode morseCodeFor(char ch);
+
+// Look up the character for a packed code (single table load).
+// Returns '\0' if the code is not assigned.
+char morseCharFor(MorseCode code);
+
+// Render a packed code as a dot/dash string for display.
+// Writes to buf (must be >= 7 bytes). Space renders as " ", unknown as "".
+// Returns the number of characters written.
+int morseCodeToString(MorseCode code, char* buf);
+
 // Encode a character to its dot/dash pattern.
 // Writes pattern to buf (must be >= 7 bytes).
 // Returns number of elements for normal chars (1-6),
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "morse_table.h"
+
+// Morse timing model shared by the engine, the key decoder and event
+// payloads. Calibrated to PARIS: one word is 50 dit units, so a word at
+// W words per minute lasts exactly 60/W seconds.
+//
+// Speeds are in the trainer's unit (characters per minute, shown as
+// "WPM" for compatibility with MTR_V2), i.e. W = speed / 5 and one dit
+// is 6,000,000 / speed us.
+//
+// Durations are unsigned Q24.8 microseconds so rounding never accumulates
+// across a word; convert with a Cursor (or toUs) at the point of use.
+namespace MorseTiming {
+
+const uint8_t  FRAC_BITS      = 8;
+const uint32_t FRAC_ONE       = 1UL << FRAC_BITS;
+const uint32_t PARIS_UNITS    = 50;        // dit units in "PARIS "
+const uint32_t PARIS_ON_UNITS = 31;        // elements + element gaps
+const uint32_t CHARS_PER_WORD = 5;         // speed unit -> words per minute
+const uint32_t US_PER_MINUTE  = 60000000UL;
+
+struct Timing {
+    uint32_t dit;        // Q8 us
+    uint32_t dah;
+    uint32_t intraGap;   // between elements of a character
+    uint32_t interGap;   // after a character
+    uint32_t wordGap;    // full gap between words (includes interGap)
+};
+
+// One PARIS word at the given speed, Q8 us (rounded)
+inline uint32_t wordQ(int speed) {
+    uint64_t num = ((uint64_t)US_PER_MINUTE * CHARS_PER_WORD) << FRAC_BITS;
+    return (uint32_t)((num + speed / 2) / speed);
+}
+
+// One dit at the given speed, Q8 us (rounded)
+inline uint32_t unitQ(int speed) {
+    uint64_t num = ((uint64_t)US_PER_MINUTE * CHARS_PER_WORD) << FRAC_BITS;
+    uint64_t den = (uint64_t)PARIS_UNITS * speed;
+    return (uint32_t)((num + den / 2) / den);
+}
+
+// Element durations at charSpeed. An effSpeed below charSpeed stretches
+// the inter-character and word gaps so a PARIS word still takes 60/W s at
+// the effective speed (ARRL Farnsworth: the 19 gap units of PARIS share
+// whatever time the fast elements leave over). effSpeed <= 0 = standard.
+inline Timing compute(int charSpeed, int effSpeed = 0) {
+    Timing t;
+    uint32_t unit = unitQ(charSpeed);
+    t.dit = unit;
+    t.dah = DAH_UNITS * unit;
+    t.intraGap = ELEMENT_GAP_UNITS * unit;
+    t.interGap = CHAR_GAP_UNITS * unit;
+    t.wordGap = (CHAR_GAP_UNITS + WORD_GAP_UNITS) * unit;
+
+    if (effSpeed > 0 && effSpeed < charSpeed) {
+        uint32_t gaps = wordQ(effSpeed) - PARIS_ON_UNITS * unit;
+        t.interGap = (uint32_t)(((uint64_t)gaps * CHAR_GAP_UNITS + 9) / 19);
+        t.wordGap = (uint32_t)(((uint64_t)gaps * (CHAR_GAP_UNITS + WORD_GAP_UNITS) + 9) / 19);
+    }
+    return t;
+}
+
+// Round a single Q8 duration to whole microseconds
+inline uint32_t toUs(uint32_t q) {
+    return (q + FRAC_ONE / 2) >> FRAC_BITS;
+}
+
+// On-air time of one character including its trailing gap, Q8 us.
+// A space is the extra silence added on top of the previous inter gap.
+inline uint32_t charQ(const Timing& t, MorseCode code) {
+    if (!code.valid()) return 0;
+    if (code.isSpace()) return t.wordGap - t.interGap;
+    uint32_t q = t.interGap;
+    for (uint8_t i = 0; i < code.len; i++) {
+        q += code.isDah(i) ? t.dah : t.dit;
+        if (i + 1 < code.len) q += t.intraGap;
+    }
+    return q;
+}
+
+// Converts a run of Q8 durations to whole microseconds, carrying the
+// sub-microsecond remainder so the run's total stays rounded, not the
+// sum of individually rounded pieces.
+class Cursor {
+public:
+    void reset() { _frac = FRAC_ONE / 2; }
+
+    // Safe to call from the timer ISR
+    uint32_t IRAM_ATTR advance(uint32_t q) {
+        uint32_t t = _frac + q;
+        _frac = t & (FRAC_ONE - 1);
+        return t >> FRAC_BITS;
+    }
+
+private:
+    uint32_t _frac = FRAC_ONE / 2;
+};
+
+} // namespace MorseTiming
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include "config.h"
+
+// Learned character weights for every profile, kept on flash so that a
+// power cut mid-save can't lose them. Two slot files (A/B) take turns:
+// a save writes the whole image to the slot not holding the newest copy,
+// with a generation one higher, so the previous copy stays intact until
+// the new one is complete. Load reads each slot with a single read and
+// keeps the valid one (magic, version, length and CRC-32 all check out)
+// with the highest generation.
+//
+// Slot layout (little endian):
+//   0  magic u32 "MTPS"     12  generation u32
+//   4  version              16  crc32 u32 over bytes 0-15 and the weights
+//   5  profiles             20  weights: profiles x chars, profile-major
+//   6  chars (per profile)
+//   7  reserved
+//   8  valid u16            bit p set: profile p has learned weights
+//  10  reserved u16
+//
+// The counts are stored, so an image written with fewer characters or
+// profiles than this build has still loads: the missing weights come
+// from the caller's defaults (the preset profile). A larger image (from
+// newer firmware) is not read.
+class ProbStore {
+public:
+    static const uint32_t MAGIC = 0x5350544DUL;  // "MTPS"
+    static const uint8_t VERSION = 1;
+    static const uint8_t HEADER_LEN = 20;
+    static const uint16_t IMAGE_LEN = HEADER_LEN + NUM_PROFILES * CHAR_COUNT;
+
+    static_assert(NUM_PROFILES <= 16, "valid mask is 16 bits");
+    static_assert(CHAR_COUNT <= 255, "chars is stored as a byte");
+
+    // Fills out[CHAR_COUNT] with profile p's starting weights
+    using DefaultsFn = void (*)(uint8_t profile, uint8_t* out);
+
+    ProbStore(FS& fs, const char* pathA, const char* pathB)
+        : _fs(fs), _paths{ pathA, pathB } {}
+
+    // Restore the newest valid slot. False if neither slot is usable
+    // (nothing saved yet); the store is then empty and saves start at A.
+    bool load(DefaultsFn defaults) {
+        _valid = 0;
+        _generation = 0;
+        _slot = 1;  // so the first save goes to A
+        int8_t best = -1;
+        int8_t inIo = -1;
+        uint32_t bestGen = 0;
+        for (uint8_t s = 0; s < 2; s++) {
+            uint32_t gen;
+            if (!readSlot(s, gen)) continue;
+            inIo = s;
+            if (best < 0 || (int32_t)(gen - bestGen) > 0) {
+                best = s;
+                bestGen = gen;
+            }
+        }
+        if (best < 0) return false;
+        if (best != inIo && !readSlot(best, bestGen)) return false;
+        decode(defaults);
+        _slot = (uint8_t)best;
+        _generation = bestGen;
+        return true;
+    }
+
+    bool has(uint8_t profile) const {
+        return profile < NUM_PROFILES && (_valid & (1u << profile));
+    }
+
+    // Copy profile's learned weights into out; false (out untouched) if none
+    bool get(uint8_t profile, uint8_t out[CHAR_COUNT]) const {
+        if (!has(profile)) return false;
+        memcpy(out, _probs[profile], CHAR_COUNT);
+        return true;
+    }
+
+    // Store profile's weights and write the image to the other slot.
+    // Unchanged weights cost nothing.
+    bool put(uint8_t profile, const uint8_t probs[CHAR_COUNT]) {
+        if (profile >= NUM_PROFILES) return false;
+        return putEach((uint16_t)(1u << profile), probs);
+    }
+
+    // The same weights for every profile in the mask, in one write
+    bool putEach(uint16_t profiles, const uint8_t probs[CHAR_COUNT]) {
+        return setEach(profiles, probs) ? save() : true;
+    }
+
+    // As putEach(), in RAM only: true if anything changed, to be written
+    // later with save()
+    bool setEach(uint16_t profiles, const uint8_t probs[CHAR_COUNT]) {
+        bool changed = false;
+        for (uint8_t p = 0; p < NUM_PROFILES; p++) {
+            if (!(profiles & (1u << p))) continue;
+            if (has(p) && memcmp(_probs[p], probs, CHAR_COUNT) == 0) continue;
+            memcpy(_probs[p], probs, CHAR_COUNT);
+            _valid |= (uint16_t)(1u << p);
+            changed = true;
+        }
+        return changed;
+    }
+
+    // Write the image to the other slot. False if that failed; the slot
+    // written before still holds the last good copy.
+    bool save() {
+        uint8_t next = _slot ^ 1;
+        uint32_t gen = _generation + 1;
+        put32(_io, MAGIC);
+        _io[4] = VERSION;
+        _io[5] = NUM_PROFILES;
+        _io[6] = CHAR_COUNT;
+        _io[7] = 0;
+        _io[8] = (uint8_t)_valid;
+        _io[9] = (uint8_t)(_valid >> 8);
+        _io[10] = _io[11] = 0;
+        put32(_io + 12, gen);
+        memcpy(_io + HEADER_LEN, _probs, NUM_PROFILES * CHAR_COUNT);
+        uint32_t crc = crc32(_io, 16);
+        put32(_io + 16, crc32(_io + HEADER_LEN, IMAGE_LEN - HEADER_LEN, crc));
+
+        File f = _fs.open(_paths[next], "w");
+        if (!f) return false;
+        bool ok = f.write(_io, IMAGE_LEN) == IMAGE_LEN;
+        f.close();
+        _writes++;
+        if (!ok) return false;  // the other slot still has the last good copy
+        _slot = next;
+        _generation = gen;
+        return true;
+    }
+
+    uint32_t generation() const { return _generation; }
+    uint8_t slot() const { return _slot; }  // holding the newest image
+    uint32_t writes() const { return _writes; }
+
+    static uint32_t crc32(const uint8_t* p, size_t n, uint32_t crc = 0) {
+        crc = ~crc;
+        while (n--) {
+            crc ^= *p++;
+            for (uint8_t k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+        }
+        return ~crc;
+    }
+
+private:
+    static uint32_t get32(const uint8_t* p) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+    static void put32(uint8_t* p, uint32_t v) {
+        p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+    }
+
+    // Read slot s into _io and check it; gen is its generation
+    bool readSlot(uint8_t s, uint32_t& gen) {
+        File f = _fs.open(_paths[s], "r");
+        if (!f) return false;
+        size_t n = f.read(_io, sizeof(_io));
+        f.close();
+        if (n < HEADER_LEN || get32(_io) != MAGIC || _io[4] != VERSION) return false;
+        uint8_t profiles = _io[5], chars = _io[6];
+        if (profiles > NUM_PROFILES || chars > CHAR_COUNT) return false;
+        size_t len = HEADER_LEN + (size_t)profiles * chars;
+        if (n != len) return false;
+        uint32_t crc = crc32(_io, 16);
+        crc = crc32(_io + HEADER_LEN, len - HEADER_LEN, crc);
+        if (crc != get32(_io + 16)) return false;
+        gen = get32(_io + 12);
+        return true;
+    }
+
+    // _io (a checked slot) -> _probs, widened to this build if older
+    void decode(DefaultsFn defaults) {
+        uint8_t profiles = _io[5], chars = _io[6];
+        uint16_t valid = (uint16_t)(_io[8] | (_io[9] << 8));
+        _valid = 0;
+        for (uint8_t p = 0; p < NUM_PROFILES && p < profiles; p++) {
+            if (!(valid & (1u << p))) continue;
+            if (chars < CHAR_COUNT) defaults(p, _probs[p]);
+            memcpy(_probs[p], _io + HEADER_LEN + (size_t)p * chars, chars);
+            _valid |= (uint16_t)(1u << p);
+        }
+    }
+
+    FS& _fs;
+    const char* _paths[2];
+    uint8_t _probs[NUM_PROFILES][CHAR_COUNT] = {};
+    uint16_t _valid = 0;
+    uint32_t _generation = 0;
+    uint8_t _slot = 1;
+    uint32_t _writes = 0;
+    uint8_t _io[IMAGE_LEN + 1];  // +1: a longer file reads as the wrong length
+};
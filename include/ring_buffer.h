@@ -0,0 +1,101 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Fixed-capacity circular buffer, N a power of two. Head and tail are
+// free-running 16-bit sequence numbers masked into the slot array, so
+// size() is a plain subtraction that stays right across wraparound and a
+// full buffer is distinguishable from an empty one without a spare slot.
+//
+// Safe as a single-producer/single-consumer queue between an ISR and
+// loop(): push() writes the slot before publishing the head and only the
+// consumer moves the tail. Methods the ISR uses are IRAM_ATTR.
+//
+// Beyond FIFO use, positions can be addressed by sequence number (at()),
+// relative to the tail (peek() looks ahead at unread items, behind()
+// looks back at consumed ones that have not been overwritten yet), and
+// the tail can be stepped back over consumed items with rewind().
+template<typename T, uint16_t N>
+class RingBuffer {
+public:
+    static_assert(N > 0 && (N & (N - 1)) == 0, "RingBuffer size must be a power of two");
+    static_assert(N <= 0x8000, "RingBuffer size must fit a 16-bit sequence distance");
+
+    static constexpr uint16_t capacity() { return N; }
+
+    // Drop everything and restart the sequence at 0
+    void reset() {
+        _head = 0;
+        _tail = 0;
+    }
+
+    // Consumer side: discard unread items
+    void clear() { _tail = _head; }
+
+    uint16_t size() const { return (uint16_t)(_head - _tail); }
+    bool empty() const { return _head == _tail; }
+    bool full() const { return size() >= N; }
+    uint16_t free() const { return N - size(); }
+
+    // Sequence numbers of the next push and the next pop
+    uint16_t head() const { return _head; }
+    uint16_t tail() const { return _tail; }
+
+    // Producer side. Returns false (and drops v) if full.
+    bool IRAM_ATTR push(const T& v) {
+        uint16_t h = _head;
+        if ((uint16_t)(h - _tail) >= N) return false;
+        _slots[h & (N - 1)] = v;
+        _head = h + 1;  // publish
+        return true;
+    }
+
+    // Consumer side. Returns false if empty.
+    bool IRAM_ATTR pop(T& out) {
+        uint16_t t = _tail;
+        if (t == _head) return false;
+        out = _slots[t & (N - 1)];
+        _tail = t + 1;
+        return true;
+    }
+
+    // Advance the tail over up to n unread items; returns how many
+    uint16_t skip(uint16_t n = 1) {
+        uint16_t s = size();
+        if (n > s) n = s;
+        _tail = _tail + n;
+        return n;
+    }
+
+    // Step the tail back over up to n consumed items that are still
+    // intact (not reused by later pushes); returns how many
+    uint16_t rewind(uint16_t n = 1) {
+        uint16_t room = free();
+        if (n > room) n = room;
+        _tail = _tail - n;
+        return n;
+    }
+
+    // Slot for a sequence number. Only meaningful within the last N pushes.
+    T& at(uint16_t seq) { return _slots[seq & (N - 1)]; }
+    const T& at(uint16_t seq) const { return _slots[seq & (N - 1)]; }
+
+    // Lookahead: i-th unread item (0 = front), i < size()
+    T& peek(uint16_t i = 0) { return at(_tail + i); }
+    const T& peek(uint16_t i = 0) const { return at(_tail + i); }
+
+    // Lookbehind: i-th consumed item (1 = the last one popped), i <= free()
+    T& behind(uint16_t i) { return at(_tail - i); }
+    const T& behind(uint16_t i) const { return at(_tail - i); }
+
+    // Signed steps from one sequence number to another (negative if
+    // "to" is older), valid while they are less than 0x8000 apart
+    static int16_t distance(uint16_t from, uint16_t to) {
+        return (int16_t)(uint16_t)(to - from);
+    }
+
+private:
+    T _slots[N];
+    volatile uint16_t _head = 0;  // written by the producer
+    volatile uint16_t _tail = 0;  // written by the consumer
+};
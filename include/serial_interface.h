@@ -5,6 +5,33 @@
 
 namespace SerialInterface {
     void begin();
-    void update();  // call from loop() to process serial input
+    void update();  // call from loop() to process serial input and write out log lines
     void onTrainerEvent(const TrainerEvent& evt);
+
+    // Which trainer events are logged
+    enum Verbosity : uint8_t {
+        QUIET,      // none
+        RESULTS,    // results, speed changes, session start/stop, context lost
+        FULL        // and a [TX] line per character sent
+    };
+    void setVerbosity(Verbosity v);
+    Verbosity verbosity();
+    const char* verbosityName(Verbosity v);
+
+    // Queue a line for the serial port without waiting on it (dropped
+    // and counted if the log is full). For event and background output;
+    // command replies print directly.
+    void log(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+    struct LogStats {
+        uint32_t lines;     // queued
+        uint32_t dropped;   // lost to a full log
+        uint32_t bytes;     // written to the UART
+        uint16_t queued;    // bytes waiting now
+        uint16_t maxQueued;
+    };
+    LogStats logStats();
+
+    // Startup phase timings (boot_timer.h)
+    void printBootReport();
 }
@@ -2,25 +2,84 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "confusion_matrix.h"
+#include "log_histogram.h"
 
 namespace Storage {
     // Initialize LittleFS. Returns true on success.
     bool begin();
 
-    // Probability persistence
-    bool saveProbs(const uint8_t probs[CHAR_COUNT]);
-    bool loadProbs(uint8_t probs[CHAR_COUNT]);
+    // Learned probabilities per profile (prob_store.h), read into RAM by
+    // restoreProbs(). A save also becomes P0's, so P0 is always the
+    // last session's state. Saves change the RAM copy (loadProbs() sees
+    // them at once); updateLearned() writes them to flash later.
+    void restoreProbs();
+    bool saveProbs(uint8_t profile, const uint8_t probs[CHAR_COUNT]);
+    // False (probs untouched) if the profile has nothing saved
+    bool loadProbs(uint8_t profile, uint8_t probs[CHAR_COUNT]);
 
-    // Config persistence (speed, last profile, WiFi settings)
+    // Confusion matrix persistence. A save is written by updateLearned()
+    // later, from m as it is then, so m must stay alive.
+    void saveConfusion(const ConfusionMatrix& m);
+    bool loadConfusion(ConfusionMatrix& m);
+
+    // Config (speed, last profile, WiFi settings), kept in RAM. Setters
+    // change the resident copy; updateConfig() writes it back later.
     struct Config {
-        int speed = DEFAULT_SPEED;
-        int profile = DEFAULT_PROFILE;
+        int16_t speed = DEFAULT_SPEED;
+        int16_t charSpeed = 0;              // Farnsworth character speed, 0 = off
+        int16_t lagLimit = CONTEXT_LOST_DIST;  // chars behind before context lost
+        int8_t profile = DEFAULT_PROFILE;
         bool buzzerActive = BUZZER_ACTIVE_DEFAULT;
-        String wifiMode = "ap";      // "ap" or "sta"
-        String staSSID = "";
-        String staPass = "";
+        char wifiMode[4] = "ap";            // "ap" or "sta"
+        char staSSID[33] = "";              // 802.11 limits
+        char staPass[65] = "";
+    };
+
+    // Dirty bits, one per field group
+    enum ConfigField : uint8_t {
+        CFG_SPEED      = 0x01,
+        CFG_CHAR_SPEED = 0x02,
+        CFG_LAG_LIMIT  = 0x04,
+        CFG_PROFILE    = 0x08,
+        CFG_BUZZER     = 0x10,
+        CFG_WIFI       = 0x20
     };
 
-    bool saveConfig(const Config& cfg);
-    bool loadConfig(Config& cfg);
+    // Read /config.json into RAM (defaults if missing). Call once after begin().
+    bool loadConfig();
+    const Config& config();
+
+    // Change a field; a no-op if the value is unchanged
+    void setSpeed(int wpm);
+    void setCharSpeed(int wpm);
+    void setLagLimit(int chars);
+    void setProfile(int profile);
+    void setBuzzerActive(bool active);
+    // False (and nothing changed) if mode isn't "ap"/"sta" or a field is too long
+    bool setWifi(const char* mode, const char* ssid, const char* pass);
+
+    // Call from loop(): writes pending changes once they have settled
+    // (CONFIG_FLUSH_DELAY_MS) and idle is true, so a flash write never
+    // lands inside a command or under a sounding character
+    void updateConfig(bool idle);
+    bool flushConfig();  // write pending changes now
+
+    // The same for saved probabilities and confusions (LEARNED_FLUSH_DELAY_MS)
+    void updateLearned(bool idle);
+
+    // Write-behind counters for one file (or set of files)
+    struct WriteStats {
+        uint8_t dirty;       // bits not yet written (ConfigField for the config)
+        uint32_t changes;    // fields changed / saves asked for
+        uint32_t flushes;    // file writes
+        uint32_t failures;   // writes that failed (retried)
+        uint32_t lastUs;     // duration of the last write
+    };
+    WriteStats configStats();
+    WriteStats probsStats();
+    WriteStats confusionStats();
+    const LogHistogram& configFlushTiming();  // write durations (us)
+    const LogHistogram& probsFlushTiming();
+    const LogHistogram& confusionFlushTiming();
 }
@@ -2,96 +2,207 @@
 
 #include <Arduino.h>
 #include "config.h"
-
-// Callback types for trainer events
+#include "morse_table.h"
+#include "weighted_sampler.h"
+#include "fast_rng.h"
+#include "confusion_matrix.h"
+#include "input_aligner.h"
+#include "ring_buffer.h"
+#include "event_bus.h"
+
+struct MorseCharStart;  // morse_engine.h
+
+// Trainer events: a compact tagged union (20 bytes on the ESP8266) so
+// they can be queued cheaply on the way to the output sinks (event_bus.h)
 struct TrainerEvent {
-    enum Type {
+    enum Type : uint8_t {
         CHAR_SENT,      // a character was sent via morse
         RESULT,         // correct/wrong result for a character
         SPEED_CHANGE,   // speed was adjusted
         SESSION_STATE,  // started/stopped
-        CONTEXT_LOST    // trainee fell too far behind
+        CONTEXT_LOST,   // trainee fell too far behind
+        CHAR_START      // a character went on air (element timeline)
     };
-
-    Type type;
+    static const uint8_t TYPE_COUNT = 6;
 
     // CHAR_SENT
-    char sentChar;
-    char pattern[8];
-    int queueDist;
+    struct Sent {
+        char ch;
+        MorseCode code;       // render with morseCodeToString() when displayed
+        uint8_t queueDist;
+        uint32_t durationUs;  // on-air time including the trailing gap
+    };
+
+    // CHAR_START: enough to replay the character's keying remotely
+    struct Tone {
+        char ch;
+        MorseCode code;
+        uint32_t startUs;     // device micros() of the first edge
+        uint32_t ditUs;       // dah = DAH_UNITS dits, element gap = 1 dit
+        uint32_t gapUs;       // silence after the last element
+    };
 
     // RESULT
-    bool correct;
-    char typedChar;
-    char expectedChar;
-    uint8_t prob;
+    struct Result {
+        bool correct;
+        char typed;
+        char expected;
+        uint8_t prob;
+        int32_t latencyMs;      // expected char done -> input, -1 if not measured
+        uint16_t latencyAvgMs;  // expected char's latency EWMA (0 = no samples yet)
+    };
 
-    // SPEED_CHANGE
-    int speed;
-    const char* direction;
+    // SPEED_CHANGE, SESSION_STATE, CONTEXT_LOST
+    struct State {
+        uint16_t speed;
+        bool running;           // SESSION_STATE
+        uint16_t charSpeed;     // SESSION_STATE: Farnsworth character speed, 0 = off
+        const char* direction;  // SPEED_CHANGE / CONTEXT_LOST
+        uint32_t ditUs;         // dit length at the new speed (morse_timing.h)
+    };
 
-    // SESSION_STATE
-    bool running;
+    Type type;
+    union {
+        Sent sent;
+        Tone tone;
+        Result result;
+        State state;
+    };
 };
 
 using TrainerEventCB = void (*)(const TrainerEvent& evt);
 
+// Queue between the trainer and serial/web/OLED output (wired in main.cpp)
+using TrainerEventBus = EventBus<TrainerEvent, EVENT_QUEUE_LENGTH, EVENT_MAX_SINKS>;
+extern TrainerEventBus eventBus;
+
 class Trainer {
 public:
     void begin();
 
+    // Seed the character generator (same seed = same practice sequence)
+    void seed(uint32_t s);
+
     // Set event callback
     void onEvent(TrainerEventCB cb);
 
-    // Start/stop training session
-    void start(int profile, int speed);
+    // Start/stop training session. charSpeed > speed sends characters at
+    // charSpeed with gaps stretched to speed (Farnsworth); 0 = off,
+    // -1 = keep the current setting.
+    void start(int profile, int speed, int charSpeed = -1);
     void stop();
     bool isRunning() const;
 
     // Process a typed input character (from serial or websocket)
     void processInput(char ch);
 
-    // Called by main loop to drive the sending state machine
+    // Process a run of typed characters (e.g. a serial line) in order
+    void processInput(const char* text, size_t len);
+
+    // Called by main loop to keep the engine's transmit queue topped up
     void update();
 
+    // Engine finished sending a character (delivered in send order).
+    // doneUs is the micros() timestamp the character's trailing gap ended.
+    void onCharDone(char ch, uint32_t doneUs);
+
+    // Engine put a character on air (word spaces are not reported on)
+    void onCharStart(const MorseCharStart& start);
+
     // Getters
     int getSpeed() const;
+    int getCharSpeed() const;
     int getProfile() const;
     const uint8_t* getProbs() const;
     bool isPlainText() const;
+    const ConfusionMatrix& getConfusion() const;
+    bool isDrill() const;
+    int getLagLimit() const;
+
+    // Smoothed recognition latency of a character in ms (0 = no samples)
+    uint16_t getLatencyMs(char ch) const;
 
     // Manual overrides
     void setSpeed(int wpm);
+    void setCharSpeed(int wpm);
     void setProfile(int p);
 
+    // How many characters the trainee may fall behind the sender before
+    // context lost (CONTEXT_LOST_DIST..MAX_LAG_DIST is typical; 1 minimum)
+    void setLagLimit(int chars);
+
+    // Drill mode: bias generated letters toward the most confused pairs
+    void setDrill(bool on);
+
+    // Forget all recorded confusions (also clears the saved copy)
+    void resetConfusion();
+
 private:
     TrainerEventCB _eventCB = nullptr;
 
     uint8_t _charProb[CHAR_COUNT];
+    WeightedSampler<CHAR_COUNT> _sampler;  // mirrors _charProb for O(log n) draws
+    FastRng _rng;
+    ConfusionMatrix _confusion;
+    ConfusionMatrix::Entry _drillPairs[DRILL_PAIRS];
+    uint8_t _drillCount = 0;
+    bool _drill = false;
     bool _plainText = false;
     bool _running = false;
-    int _speed = DEFAULT_SPEED;
+    int _speed = DEFAULT_SPEED;     // effective speed (adapted)
+    int _charSpeed = 0;             // Farnsworth character speed, 0 = off
     int _profile = DEFAULT_PROFILE;
-
-    // Circular queue
-    char _queue[QUEUE_LENGTH + 1];
-    int _queueIndexS = 0;  // send index
-    int _queueIndexR = 0;  // receive index
+    int _lagLimit = CONTEXT_LOST_DIST;
+
+    // Sent-character queue. Head: next char to queue in the engine;
+    // tail: next char to be answered. _sentSeq sits between them and
+    // marks the next char to finish sending.
+    struct QueuedChar {
+        char ch;
+        uint32_t doneUs;  // when it finished sending
+    };
+    using SendQueue = RingBuffer<QueuedChar, QUEUE_LENGTH>;
+    SendQueue _queue;
+    uint16_t _sentSeq = 0;
     int _lGroup = 0;       // letters in current group
     int _statErrors = 0;
     int _statGroup = 0;
     int _recoverySpaces = 0; // pending spaces after context lost (drained non-blockingly)
+    int _recoveryInFlight = 0; // recovery spaces queued in the engine
+
+    // Input alignment: typed chars since the _alignBase sequence number,
+    // re-aligned against the sent queue on every keypress (see
+    // input_aligner.h)
+    char _alignTyped[InputAligner::MAX_TYPED - 1];
+    uint8_t _alignLen = 0;
+    uint16_t _alignBase = 0;
+    uint16_t _alignScored = 0;  // bit i: sent char _alignBase + i has a result
+
+    // Recognition latency
+    uint16_t _latencyEwma[CHAR_COUNT];   // per char, ms in Q(LATENCY_EWMA_SHIFT)
+    uint16_t _winLatency[STAT_LENGTH];   // ms samples in the current speed window
+    uint8_t _winLatencyCount = 0;
 
     int queueDist() const;
-    int indexAdv(int index) const;
+    int queueAhead() const;
+    void advanceReceive();
+    void alignInput(char ch);
     char generateLetter();
-    void correct(char letter);
-    void wrong(char typed, char expected);
+    char generateDrillLetter();
+    void refreshDrill();
+    void correct(char letter, int32_t latencyMs);
+    void wrong(char typed, char expected, int32_t latencyMs);
+    int32_t measureLatency() const;
+    void recordLatency(char expected, int32_t latencyMs);
+    uint16_t windowLatency(uint8_t pct) const;
     void analyzeSpeed();
+    void applySpeed();
     void contextLost();
     void loadProfile(int profile);
+    void setProb(int idx, uint8_t prob);
     void emitEvent(const TrainerEvent& evt);
-    void sendNextChar();
+    void queueNextChar();
+    void resetQueue();
 };
 
 extern Trainer trainer;
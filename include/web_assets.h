@@ -0,0 +1,445 @@
+#pragma once
+
+// Generated by tools/embed_web_assets.py from data/ - do not edit.
+// Gzipped web UI served from flash (see web_server.cpp).
+
+#include <Arduino.h>
+
+namespace WebAssets {
+
+struct Asset {
+    const char* path;
+    const char* type;
+    const char* etag;       // strong, quoted
+    bool immutable;         // URL carries the content hash
+    const uint8_t* gz;      // PROGMEM
+    uint32_t len;
+};
+
+// style.css: 3572 bytes minified, 1234 gzipped
+static const uint8_t STYLE_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x56, 0xdd, 0xae, 0xa3, 0x38,
+    0x0c, 0xbe, 0xdf, 0xa7, 0x88, 0x54, 0x8d, 0xa6, 0x9d, 0x6d, 0x2a, 0x4a, 0x7f, 0xb6, 0x03, 0x37,
+    0xfb, 0x18, 0x7b, 0x1b, 0x48, 0x28, 0xd9, 0x86, 0x04, 0x85, 0xd0, 0x9f, 0x41, 0x7d, 0xf7, 0x75,
+    0x42, 0xa0, 0xd0, 0xd2, 0x33, 0xbd, 0x58, 0x1d, 0xa9, 0x27, 0x09, 0xb6, 0xf3, 0xd9, 0xfe, 0x6c,
+    0xe7, 0xc7, 0x12, 0xfd, 0x88, 0xa2, 0x84, 0x65, 0x4a, 0x33, 0xb7, 0x24, 0x99, 0x61, 0xba, 0x49,
+    0xd4, 0x15, 0x57, 0xfc, 0x17, 0x97, 0xc7, 0x08, 0x25, 0x4a, 0x53, 0xa6, 0x31, 0x1c, 0xc5, 0x05,
+    0xd1, 0x47, 0x2e, 0x23, 0x14, 0xc4, 0x25, 0xa1, 0xd4, 0x7d, 0x0d, 0xe2, 0x7b, 0xa4, 0x95, 0x32,
+    0x0d, 0xc6, 0x09, 0x6c, 0x67, 0x6b, 0xb2, 0x26, 0x21, 0x8b, 0x31, 0xae, 0x6a, 0x9d, 0x91, 0x94,
+    0xd9, 0xa3, 0x7d, 0xb8, 0xde, 0x0c, 0x8e, 0x42, 0x38, 0x0b, 0xb2, 0xcd, 0x76, 0x1f, 0xc0, 0x99,
+    0x61, 0x57, 0x03, 0x7b, 0x16, 0xd8, 0x3f, 0xbf, 0xc7, 0x94, 0x17, 0x70, 0x76, 0x38, 0x1c, 0xe0,
+    0x20, 0x55, 0x5a, 0xb3, 0xd4, 0x38, 0x9d, 0x9f, 0xc9, 0xce, 0x1e, 0x5d, 0xb4, 0xb2, 0x57, 0xcf,
+    0xd8, 0xcf, 0xed, 0xce, 0x19, 0x39, 0xb1, 0x5b, 0x7b, 0x7b, 0x48, 0x42, 0xb2, 0x25, 0xfe, 0x84,
+    0xa4, 0x86, 0x9f, 0x2d, 0x80, 0x0d, 0xd9, 0x90, 0x3d, 0x89, 0xef, 0xb9, 0x29, 0xc4, 0x12, 0xfc,
+    0xa1, 0xb7, 0x26, 0x67, 0xfc, 0x98, 0x83, 0xd1, 0x75, 0x10, 0xd0, 0x73, 0x1e, 0xab, 0x33, 0xd3,
+    0x99, 0x50, 0x97, 0x08, 0xe5, 0x9c, 0x52, 0x26, 0x63, 0xa3, 0xea, 0x34, 0x77, 0x16, 0x14, 0xf8,
+    0x5b, 0x10, 0xc9, 0xcb, 0x5a, 0x10, 0xbb, 0x8b, 0xef, 0xce, 0x40, 0xa6, 0xa4, 0xc1, 0x19, 0x29,
+    0xb8, 0xb8, 0x45, 0x08, 0x93, 0xb2, 0x14, 0x0c, 0x57, 0xb7, 0xca, 0xb0, 0x62, 0x89, 0xda, 0xff,
+    0xb8, 0xe6, 0xb0, 0x24, 0xb2, 0xc2, 0x15, 0xd3, 0x3c, 0x8b, 0x13, 0x92, 0x9e, 0x8e, 0x5a, 0xd5,
+    0x92, 0x46, 0xe8, 0x4c, 0xf4, 0xdc, 0x06, 0x6c, 0x11, 0xa7, 0x4a, 0x28, 0xdd, 0x1d, 0x58, 0xe7,
+    0x17, 0x31, 0xe5, 0x55, 0x29, 0x08, 0x98, 0xcd, 0x04, 0xbb, 0xc6, 0xf6, 0x07, 0x02, 0x62, 0x63,
+    0xe0, 0xb0, 0x80, 0x42, 0x5d, 0xc8, 0xb8, 0xcd, 0x4a, 0x84, 0xb6, 0xe5, 0x15, 0x55, 0x4a, 0x70,
+    0x8a, 0x8c, 0x86, 0xbb, 0x4a, 0xa2, 0x99, 0x34, 0xb1, 0x5b, 0xf3, 0x56, 0xc1, 0xe7, 0xcf, 0x5d,
+    0x84, 0x82, 0xd5, 0xba, 0x6a, 0x3d, 0x58, 0x65, 0x82, 0x54, 0x79, 0x17, 0xde, 0x66, 0x28, 0xd5,
+    0xc1, 0xf1, 0xdf, 0x16, 0x23, 0x05, 0x17, 0xfc, 0x49, 0x71, 0xf7, 0x05, 0x84, 0x57, 0xa9, 0x92,
+    0x12, 0x53, 0xe0, 0xc4, 0x85, 0x53, 0x93, 0xdb, 0x20, 0x97, 0xd7, 0xf8, 0x11, 0x71, 0xd8, 0x78,
+    0x75, 0x4d, 0x28, 0xaf, 0xab, 0x08, 0xed, 0x82, 0x6f, 0x13, 0xe1, 0xf1, 0xf6, 0x5c, 0x00, 0xaa,
+    0x5c, 0x73, 0x79, 0x72, 0x74, 0xeb, 0xcd, 0xbb, 0x05, 0xe0, 0x63, 0xb4, 0x79, 0x55, 0x7e, 0x60,
+    0x9f, 0xf5, 0x70, 0x4a, 0xd5, 0xc5, 0x24, 0xe3, 0x57, 0x46, 0x21, 0xc9, 0x65, 0x84, 0x0e, 0x00,
+    0x47, 0xb7, 0xd0, 0xec, 0xb2, 0x0f, 0xbe, 0x54, 0x92, 0xc5, 0xbf, 0x30, 0x97, 0x94, 0x5d, 0x2d,
+    0x6a, 0x30, 0x54, 0x31, 0x63, 0x80, 0xf4, 0x55, 0xd3, 0xb3, 0x1f, 0x34, 0xbc, 0x43, 0x2f, 0x00,
+    0x3c, 0xd9, 0x27, 0xf0, 0x77, 0x66, 0xb0, 0x56, 0x97, 0x66, 0x9c, 0x6c, 0x22, 0xf8, 0x51, 0x62,
+    0x0e, 0xec, 0x81, 0xa8, 0xa4, 0x90, 0x49, 0xa6, 0xe3, 0x23, 0xf1, 0x28, 0xdb, 0xea, 0x83, 0x42,
+    0x34, 0x46, 0x41, 0x7d, 0xec, 0xe1, 0x68, 0x6c, 0x2c, 0x82, 0x04, 0x19, 0x9c, 0xe6, 0x5c, 0xd0,
+    0xe6, 0x49, 0xd8, 0xc2, 0x2f, 0xb5, 0xca, 0xb8, 0xa5, 0x29, 0x13, 0x36, 0xe3, 0xf6, 0x42, 0x70,
+    0x2c, 0x2e, 0x40, 0xcc, 0x27, 0x2a, 0xf8, 0x9c, 0xa4, 0x1d, 0xff, 0xd6, 0x3d, 0xff, 0x46, 0x6e,
+    0x87, 0x8b, 0x47, 0x8b, 0x00, 0xa0, 0x0e, 0xff, 0x53, 0xd2, 0x81, 0xb9, 0xb1, 0xab, 0x22, 0x68,
+    0x34, 0x50, 0xa5, 0x6b, 0xbb, 0x87, 0x18, 0x97, 0x8c, 0x51, 0x88, 0x7a, 0x59, 0x9b, 0x25, 0x9a,
+    0xa5, 0x39, 0xd1, 0x78, 0x70, 0xd4, 0x31, 0x6a, 0x17, 0x4e, 0xc6, 0xfc, 0xff, 0xc1, 0xba, 0xfd,
+    0x0c, 0xab, 0xeb, 0x54, 0x2e, 0x61, 0x7d, 0xaa, 0x00, 0xbe, 0x21, 0xda, 0xe0, 0xc4, 0x48, 0x00,
+    0x5f, 0x01, 0xbf, 0xec, 0xb2, 0x19, 0x59, 0x5f, 0xef, 0x7b, 0xf3, 0x9e, 0x64, 0x1f, 0xdc, 0x95,
+    0xd6, 0xba, 0xb2, 0x5e, 0x95, 0x8a, 0xbb, 0x8b, 0xbc, 0x93, 0xb3, 0x2c, 0xcb, 0x86, 0x97, 0x36,
+    0x6f, 0x69, 0x18, 0x2e, 0x86, 0x72, 0x91, 0x6f, 0x8d, 0x52, 0x99, 0x79, 0x04, 0x0c, 0x24, 0x89,
+    0x60, 0x74, 0x31, 0xd2, 0x86, 0x46, 0xbe, 0x0b, 0xff, 0xda, 0x3b, 0x2d, 0xef, 0xc6, 0xdb, 0x0a,
+    0x7d, 0xc8, 0xbc, 0x31, 0xac, 0x4a, 0x92, 0x72, 0x03, 0x24, 0x0f, 0x56, 0x87, 0x11, 0x8e, 0x4e,
+    0x64, 0x10, 0xad, 0xfe, 0x6c, 0xa8, 0xb5, 0xd9, 0xf5, 0x21, 0xa0, 0x2c, 0x23, 0xb5, 0x30, 0x60,
+    0xe6, 0x52, 0x16, 0x58, 0x90, 0x84, 0x89, 0x8e, 0xec, 0x82, 0x65, 0x50, 0xc5, 0xa4, 0x36, 0xea,
+    0x35, 0x80, 0xcf, 0xac, 0xb0, 0x33, 0x66, 0x11, 0x5f, 0x72, 0xa8, 0x35, 0x20, 0x98, 0x1b, 0x54,
+    0x52, 0x5d, 0x34, 0x29, 0x6d, 0x4d, 0x01, 0x45, 0x20, 0x21, 0xad, 0x6d, 0xcf, 0xb8, 0x6d, 0x30,
+    0x95, 0x96, 0x69, 0xab, 0xcf, 0x15, 0x3f, 0x2b, 0xb9, 0x81, 0x69, 0xd2, 0x9a, 0x9d, 0xae, 0x3b,
+    0x92, 0x5a, 0x0a, 0x8d, 0xfb, 0xe9, 0x20, 0x75, 0x1d, 0xa4, 0x33, 0x11, 0x35, 0x1b, 0x15, 0xc1,
+    0x87, 0x90, 0x86, 0x64, 0x75, 0xdd, 0xee, 0xb5, 0x2d, 0x19, 0x75, 0x3c, 0x0a, 0x36, 0x68, 0x92,
+    0x9a, 0xd9, 0x89, 0x77, 0x66, 0x8f, 0x9e, 0xc8, 0xa5, 0xe0, 0x92, 0xe1, 0x44, 0xa8, 0xf4, 0x14,
+    0x77, 0x81, 0x09, 0x07, 0xcd, 0x3d, 0x74, 0xe4, 0x9d, 0xb6, 0x8c, 0xda, 0x0a, 0x7e, 0x64, 0x35,
+    0xee, 0xbd, 0xef, 0xd4, 0x1f, 0xc2, 0x5d, 0xb0, 0x1e, 0x68, 0x48, 0x02, 0xa5, 0x5b, 0x1b, 0x16,
+    0x73, 0x09, 0x3d, 0x6f, 0xba, 0x57, 0x3d, 0x22, 0xf6, 0x54, 0x53, 0xe1, 0x54, 0x11, 0x8d, 0x86,
+    0x64, 0x6f, 0x0b, 0xd8, 0x16, 0x56, 0xcf, 0x38, 0xba, 0x27, 0x52, 0x03, 0xb3, 0xc4, 0x40, 0xa2,
+    0x22, 0xf4, 0xfd, 0x7b, 0x3c, 0x81, 0xad, 0x65, 0xe0, 0xc6, 0x76, 0x07, 0x3b, 0x5b, 0xec, 0xa2,
+    0x9b, 0x81, 0x87, 0xe1, 0x0c, 0x3c, 0x4c, 0xb6, 0xaf, 0x61, 0xb7, 0x1a, 0xcd, 0xc6, 0x21, 0x52,
+    0xb7, 0x06, 0x2c, 0xc5, 0x18, 0x68, 0x1b, 0xdd, 0x28, 0xcd, 0x59, 0x7a, 0x62, 0x14, 0xfd, 0x89,
+    0x9e, 0x02, 0xf9, 0xd5, 0x84, 0xfc, 0xcc, 0x44, 0x1f, 0x83, 0x1e, 0x81, 0x07, 0x03, 0x2c, 0x61,
+    0xff, 0xcc, 0xad, 0x4f, 0xb6, 0x15, 0x9c, 0x92, 0x9e, 0xe1, 0x1f, 0x3d, 0x64, 0xfe, 0xad, 0x2b,
+    0xc3, 0xb3, 0x1b, 0xee, 0x23, 0xeb, 0x7b, 0xe9, 0xb0, 0x69, 0xb6, 0x33, 0x70, 0x67, 0x67, 0x20,
+    0x14, 0xcd, 0x90, 0x2d, 0xa7, 0x64, 0x62, 0x8a, 0xbe, 0x33, 0xe9, 0xac, 0xb8, 0x31, 0xe3, 0xf5,
+    0x22, 0x69, 0xf2, 0x76, 0x5e, 0xce, 0xc3, 0xc5, 0xa3, 0x4d, 0x07, 0x68, 0xfb, 0x6d, 0x4a, 0x66,
+    0x33, 0x92, 0x59, 0x07, 0x4e, 0x88, 0xdd, 0x1e, 0x15, 0x4d, 0xae, 0x5d, 0x45, 0xef, 0xf6, 0x4f,
+    0x60, 0xb7, 0xdb, 0x41, 0xfe, 0x53, 0x41, 0x8a, 0x72, 0x6e, 0x8f, 0x96, 0xe8, 0x70, 0xce, 0x97,
+    0x68, 0xbf, 0xb5, 0xc1, 0xfb, 0xfd, 0x5b, 0xe0, 0x9d, 0x67, 0xaf, 0xd9, 0x6d, 0x9f, 0xc4, 0x5f,
+    0x8e, 0xc3, 0xa9, 0xe1, 0xb3, 0x1b, 0xb7, 0x94, 0x16, 0xe8, 0xda, 0x01, 0xdd, 0xac, 0x76, 0xe7,
+    0xcb, 0x12, 0x85, 0x81, 0x85, 0xea, 0x64, 0x2e, 0xde, 0x9d, 0x7d, 0x10, 0xbc, 0x14, 0x57, 0x0d,
+    0x8f, 0x5e, 0xff, 0xd2, 0xf0, 0x37, 0x81, 0x78, 0x72, 0xe2, 0x06, 0xbf, 0xff, 0x62, 0x48, 0x89,
+    0x73, 0x30, 0x29, 0xac, 0xd9, 0xae, 0x17, 0x0e, 0x9f, 0xb5, 0x2e, 0xdc, 0x7e, 0xc6, 0x2c, 0x91,
+    0xdd, 0xac, 0xda, 0x4d, 0x33, 0x1d, 0x80, 0xf6, 0xe3, 0xa2, 0xd5, 0xc3, 0xbe, 0xc1, 0x0d, 0xb2,
+    0x74, 0x08, 0x7c, 0xbb, 0x82, 0xec, 0xad, 0x76, 0x13, 0x8e, 0x87, 0xce, 0x71, 0xeb, 0xb6, 0x1d,
+    0xdb, 0x8b, 0x2f, 0x5b, 0xce, 0xfd, 0xef, 0x82, 0x51, 0x4e, 0xd0, 0x5c, 0x69, 0x0e, 0x60, 0x49,
+    0xcb, 0xf2, 0x52, 0x69, 0xf0, 0x80, 0x9b, 0x45, 0xf3, 0x78, 0x3e, 0xf6, 0x79, 0x6e, 0x1b, 0xe9,
+    0xe0, 0x85, 0x3a, 0x7e, 0x7d, 0xde, 0xa7, 0x4d, 0x0a, 0x22, 0x69, 0x95, 0x92, 0x92, 0x4d, 0xda,
+    0x6c, 0x35, 0x27, 0x4c, 0xfa, 0xcb, 0xee, 0x7f, 0xfc, 0x07, 0xf4, 0x0b, 0xd6, 0xa3, 0xf4, 0x0d,
+    0x00, 0x00,
+};
+
+// app.js: 13407 bytes minified, 4431 gzipped
+static const uint8_t APP_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5b, 0x6d, 0x57, 0xe3, 0x38,
+    0xb2, 0xfe, 0x9e, 0x5f, 0x61, 0xf6, 0x43, 0xdb, 0x19, 0x92, 0x90, 0x00, 0xcd, 0x74, 0x27, 0xfd,
+    0xb2, 0x34, 0x30, 0x33, 0xcc, 0xf0, 0x76, 0x09, 0x74, 0xef, 0x2e, 0xc3, 0xe1, 0x38, 0xb1, 0x08,
+    0xde, 0x76, 0xec, 0x8c, 0xed, 0x40, 0x33, 0x3d, 0xdc, 0xdf, 0x7e, 0x9f, 0x2a, 0x49, 0xb6, 0x64,
+    0x9b, 0x97, 0xbb, 0xe7, 0xec, 0xec, 0x2a, 0x24, 0x52, 0x55, 0xa9, 0x54, 0x2a, 0x55, 0x3d, 0x25,
+    0xbb, 0xbd, 0xeb, 0x65, 0x3c, 0xcd, 0xc3, 0x24, 0x76, 0xbc, 0xb6, 0xf3, 0xbd, 0xe5, 0x2e, 0x33,
+    0xe1, 0x64, 0x79, 0x1a, 0x4e, 0x73, 0x77, 0xd4, 0xba, 0xf5, 0x53, 0x67, 0x91, 0x26, 0xd7, 0x61,
+    0x24, 0xc6, 0x22, 0x12, 0xd3, 0xdc, 0x79, 0xef, 0x04, 0xc9, 0x74, 0x39, 0x17, 0x71, 0xde, 0x9b,
+    0x89, 0x7c, 0x2f, 0x12, 0xf4, 0xf5, 0xd3, 0xfd, 0x7e, 0xe0, 0xb9, 0x8a, 0xb0, 0x9b, 0x31, 0xa5,
+    0xdb, 0x96, 0xec, 0xd9, 0x42, 0x88, 0x60, 0x3f, 0x5e, 0x2c, 0x9f, 0xe4, 0x65, 0xaa, 0x6e, 0x48,
+    0x64, 0x9a, 0x71, 0x7a, 0xe3, 0xa7, 0xe3, 0x17, 0x31, 0x13, 0x65, 0xb7, 0x41, 0x42, 0x96, 0xfb,
+    0x69, 0xfe, 0x29, 0x8f, 0x9f, 0x9c, 0x98, 0x68, 0xba, 0x93, 0x3c, 0x2e, 0x99, 0x92, 0xc5, 0xb3,
+    0x3c, 0xc9, 0xc2, 0x64, 0xb9, 0x5b, 0xcc, 0x0f, 0xfc, 0x89, 0x88, 0x9e, 0xe2, 0x01, 0x4d, 0x37,
+    0x22, 0x22, 0xcd, 0xf4, 0x75, 0xb2, 0xf7, 0x24, 0xc3, 0xd7, 0x49, 0x61, 0x88, 0x24, 0x8e, 0x77,
+    0x93, 0xa7, 0x2d, 0x00, 0x92, 0x6e, 0x90, 0xe4, 0x15, 0x96, 0x93, 0x24, 0xcd, 0x53, 0x3f, 0x7c,
+    0x11, 0x6b, 0x77, 0xa1, 0x88, 0xb5, 0x8c, 0x45, 0x98, 0x4f, 0x6f, 0xc6, 0x51, 0x18, 0x88, 0xf4,
+    0xc9, 0x5d, 0x27, 0xb2, 0x6e, 0xc6, 0x74, 0x16, 0xeb, 0x67, 0x3f, 0x5a, 0x8a, 0xe7, 0x39, 0x6f,
+    0x89, 0xcc, 0x62, 0x3c, 0x4d, 0xee, 0x9e, 0x67, 0x4b, 0x93, 0x3b, 0xcd, 0x34, 0x59, 0xfe, 0xf9,
+    0xa7, 0x48, 0xb7, 0xe1, 0xc4, 0xb7, 0x4f, 0xce, 0x27, 0xe9, 0xba, 0x3e, 0x13, 0xda, 0xcc, 0xcf,
+    0x6e, 0x9f, 0xe2, 0xb5, 0x76, 0x30, 0xc3, 0x92, 0xf3, 0x24, 0x16, 0x3b, 0x37, 0x62, 0xfa, 0xf5,
+    0x49, 0x7f, 0x51, 0x84, 0xdd, 0x24, 0xae, 0xf2, 0x3e, 0x3b, 0x71, 0xc1, 0x6b, 0x4d, 0x7d, 0xb0,
+    0xfd, 0xcf, 0xbd, 0xd3, 0xab, 0xed, 0x83, 0x93, 0x5f, 0xb6, 0xc1, 0x7c, 0xd1, 0xba, 0x70, 0xff,
+    0xc7, 0xed, 0xb8, 0x5f, 0xd0, 0xf6, 0xd0, 0x4e, 0xd1, 0xce, 0xd0, 0xfe, 0x89, 0x76, 0x8e, 0xb6,
+    0x8f, 0x76, 0x8c, 0x76, 0xe2, 0x5e, 0x76, 0x40, 0xba, 0x8d, 0xaf, 0x63, 0xb4, 0x5d, 0xb4, 0x9f,
+    0xd0, 0x7e, 0x46, 0xfb, 0x05, 0xed, 0x57, 0xb4, 0xdf, 0xd0, 0x0e, 0x24, 0xd9, 0xbf, 0xf0, 0xf5,
+    0x1f, 0x68, 0x3b, 0x68, 0x9f, 0xd1, 0x3e, 0xa1, 0x1d, 0xa1, 0x1d, 0xba, 0x97, 0xad, 0x4b, 0x53,
+    0x8d, 0xa3, 0xf3, 0x43, 0xa5, 0xc4, 0x00, 0xc3, 0xeb, 0x68, 0x1b, 0x68, 0x9b, 0x68, 0xaf, 0xd1,
+    0xb6, 0xd0, 0x7e, 0x44, 0x7b, 0x83, 0xf6, 0x16, 0xad, 0x2f, 0xa5, 0xaf, 0xe2, 0x6b, 0x17, 0xad,
+    0x87, 0x46, 0xff, 0x5b, 0x43, 0x1b, 0xba, 0x1d, 0xc7, 0x7d, 0x8f, 0x2f, 0x1f, 0xd1, 0x3c, 0x49,
+    0xd7, 0xc6, 0xd7, 0xbf, 0xa1, 0xfd, 0xee, 0xe2, 0xe3, 0xef, 0x68, 0x2b, 0x68, 0xaf, 0x4a, 0x15,
+    0xa6, 0xcb, 0x34, 0x85, 0xb1, 0x0e, 0xfc, 0x7b, 0x76, 0xd3, 0xfe, 0xc8, 0x59, 0x5b, 0x73, 0xfa,
+    0xf8, 0xe6, 0x47, 0x8b, 0x1b, 0xbf, 0xe3, 0x0c, 0xf0, 0x35, 0x5e, 0xce, 0x5b, 0x45, 0x94, 0x9b,
+    0x2c, 0xc3, 0x28, 0xf8, 0x4d, 0xdc, 0x4f, 0x12, 0x3f, 0x0d, 0x38, 0xe4, 0x91, 0x98, 0x88, 0xf8,
+    0x33, 0xd0, 0xda, 0xf2, 0xde, 0x43, 0xa2, 0xf3, 0xd1, 0x32, 0xf7, 0xb0, 0x5c, 0xb5, 0xd4, 0x20,
+    0x4f, 0x66, 0xb3, 0xa8, 0xd8, 0xc8, 0x46, 0x7e, 0x77, 0xb0, 0xbe, 0xe1, 0x82, 0xd3, 0xdd, 0xfe,
+    0xb4, 0x83, 0xa8, 0x4a, 0x47, 0xbf, 0x17, 0xc6, 0xb1, 0x48, 0x7f, 0x39, 0x3b, 0x3c, 0x00, 0x93,
+    0x8b, 0xce, 0xeb, 0x24, 0x75, 0x3c, 0x92, 0xa7, 0x96, 0x91, 0x3a, 0xef, 0x94, 0x56, 0xbd, 0x48,
+    0xc4, 0xb3, 0xfc, 0x06, 0x5d, 0xab, 0xab, 0x5a, 0x5f, 0xb8, 0xff, 0x6e, 0x78, 0x6b, 0x3a, 0xce,
+    0x34, 0x15, 0x7e, 0x2e, 0x94, 0xef, 0x78, 0x6e, 0x10, 0xde, 0x92, 0xb3, 0x48, 0xba, 0xde, 0x34,
+    0xf2, 0xb3, 0xec, 0xc8, 0x9f, 0xd3, 0xf9, 0x40, 0x64, 0xe1, 0xd3, 0x33, 0xd2, 0x82, 0xd0, 0x27,
+    0x27, 0xba, 0x48, 0x2f, 0x0d, 0x3d, 0xa6, 0x52, 0x8f, 0x29, 0xf4, 0x00, 0x51, 0xa1, 0xc4, 0xb4,
+    0x54, 0x62, 0x62, 0x87, 0xc9, 0x8a, 0x06, 0x93, 0x65, 0x9e, 0x4b, 0x87, 0x07, 0x5d, 0x45, 0x03,
+    0x71, 0xef, 0xca, 0xee, 0x5c, 0x7c, 0xcb, 0x77, 0x92, 0x38, 0x07, 0x07, 0x06, 0x30, 0xcf, 0xc5,
+    0xf4, 0x52, 0x8e, 0x04, 0x7e, 0xee, 0x67, 0x02, 0x52, 0x11, 0xdc, 0x8d, 0x21, 0xb5, 0x20, 0x7f,
+    0xb1, 0x10, 0x71, 0xb0, 0x73, 0x83, 0xbd, 0xf4, 0x40, 0x8d, 0x49, 0x1e, 0xa4, 0x59, 0xcd, 0x01,
+    0x49, 0xcb, 0x63, 0xe5, 0x46, 0x55, 0xa2, 0x4b, 0xb3, 0xd9, 0x0a, 0xd2, 0x27, 0x2c, 0x27, 0x69,
+    0x3e, 0xbd, 0xd0, 0x06, 0x05, 0x75, 0xcd, 0x12, 0x0e, 0x5a, 0x57, 0x0e, 0xbb, 0x26, 0x9d, 0x6d,
+    0x1a, 0xc3, 0xcb, 0x4c, 0x22, 0x6d, 0x25, 0xd9, 0x43, 0x12, 0x07, 0xae, 0xa9, 0xbe, 0x69, 0x8e,
+    0x82, 0xab, 0x3d, 0xaa, 0xdb, 0xaa, 0x60, 0x31, 0x4c, 0x19, 0x04, 0x7b, 0xb7, 0xe4, 0xcb, 0x61,
+    0x06, 0x25, 0x44, 0x8a, 0xd0, 0x9b, 0x84, 0xd0, 0x27, 0x0d, 0x92, 0xbb, 0x18, 0x47, 0xb5, 0x04,
+    0x0e, 0xc2, 0xf6, 0x08, 0xd1, 0x43, 0x52, 0x9d, 0xd1, 0xde, 0x45, 0x49, 0x26, 0x32, 0xd8, 0xa1,
+    0x47, 0x3b, 0x0e, 0xc9, 0xe1, 0xb5, 0xe3, 0xad, 0xd0, 0x7e, 0x39, 0xa9, 0xc8, 0x97, 0x69, 0x3c,
+    0x6a, 0x89, 0xde, 0x22, 0x15, 0x34, 0xcb, 0xae, 0xb8, 0xf6, 0x97, 0x51, 0xee, 0x29, 0xaa, 0x49,
+    0x6d, 0x71, 0x34, 0x47, 0xe5, 0xb4, 0x37, 0x1e, 0xb6, 0x01, 0x0e, 0x5a, 0x1f, 0x3e, 0x64, 0x9f,
+    0x73, 0x78, 0x8e, 0x9a, 0xf1, 0xa1, 0x26, 0x9f, 0x5c, 0x8c, 0xa4, 0x67, 0xb0, 0x86, 0xf7, 0xdd,
+    0xc9, 0xef, 0x17, 0x62, 0x28, 0x9d, 0xb4, 0xc3, 0x28, 0x64, 0xe8, 0xd4, 0x1c, 0xf2, 0x81, 0xcd,
+    0x44, 0x9f, 0xc5, 0xd6, 0xd7, 0xcd, 0x05, 0x09, 0xcd, 0xa6, 0x22, 0x05, 0x0a, 0x23, 0xe5, 0xfe,
+    0x4c, 0x7a, 0x03, 0xf4, 0x77, 0xf7, 0x8f, 0x4e, 0xce, 0xcf, 0x5c, 0xe7, 0xaf, 0xbf, 0x9c, 0xe6,
+    0xf1, 0xf1, 0xde, 0xc1, 0xde, 0xce, 0x99, 0x5b, 0xda, 0x4f, 0x8a, 0x9a, 0x8b, 0xdc, 0xc7, 0x5a,
+    0x25, 0xdf, 0x34, 0x4f, 0xa3, 0xe2, 0x87, 0x1f, 0xe5, 0xf8, 0x5e, 0xd2, 0x4b, 0x64, 0xc5, 0x9b,
+    0x04, 0xf5, 0x24, 0xff, 0xf4, 0x46, 0x9d, 0x6e, 0x9e, 0x63, 0xe0, 0xbc, 0x7a, 0xe5, 0xac, 0x5d,
+    0xf8, 0xdd, 0x3f, 0xb7, 0xbb, 0xff, 0xea, 0x77, 0xdf, 0xae, 0xfe, 0xde, 0xed, 0x75, 0x7e, 0x5f,
+    0x1b, 0xbe, 0xff, 0xe8, 0xb5, 0xdd, 0xbf, 0xfd, 0x7d, 0xe5, 0xd5, 0xe5, 0x1a, 0x7c, 0x13, 0xbb,
+    0x3a, 0xbd, 0x69, 0xd3, 0x62, 0x9a, 0x76, 0xf0, 0x71, 0x4b, 0x62, 0xae, 0x3c, 0x39, 0x87, 0xe3,
+    0xa5, 0x3b, 0xb0, 0x26, 0xe2, 0x6f, 0x69, 0x49, 0x03, 0x70, 0x34, 0x18, 0x53, 0x22, 0x3b, 0xd3,
+    0x94, 0xda, 0xe9, 0xae, 0x53, 0xf1, 0x07, 0x16, 0xb4, 0xf0, 0xd3, 0x4c, 0xec, 0xe3, 0xd4, 0x99,
+    0x72, 0x18, 0x5d, 0x20, 0x0b, 0xf4, 0xb5, 0x7c, 0x46, 0x25, 0x95, 0xb3, 0xc5, 0x02, 0x56, 0x1d,
+    0xd7, 0xf9, 0xe5, 0x4f, 0x97, 0x74, 0xcf, 0xc7, 0x2a, 0xe9, 0x9e, 0x10, 0x87, 0x47, 0xc3, 0xb5,
+    0x35, 0x4d, 0x93, 0xf9, 0xdc, 0x8f, 0x03, 0x5a, 0xd7, 0x3c, 0xc0, 0x6f, 0x16, 0x4e, 0xea, 0x81,
+    0x78, 0x28, 0x25, 0xf2, 0xca, 0xd0, 0x0a, 0x8d, 0x97, 0x0b, 0xf8, 0x90, 0x14, 0x8a, 0x83, 0xc6,
+    0xfa, 0x6b, 0xc0, 0xd3, 0xcb, 0xf2, 0xfb, 0x48, 0xf4, 0x82, 0x30, 0x5b, 0x20, 0x16, 0x43, 0x27,
+    0x1c, 0x13, 0x03, 0xd6, 0xc0, 0xe9, 0x80, 0x31, 0x44, 0x40, 0x7b, 0xaa, 0x11, 0xc1, 0x31, 0x4e,
+    0x11, 0x52, 0xcb, 0x75, 0x24, 0xbe, 0x71, 0x6e, 0x89, 0xd1, 0xe7, 0x92, 0x2d, 0x2b, 0xf3, 0x7d,
+    0x62, 0x39, 0xe7, 0xfb, 0x9e, 0x04, 0x3e, 0x34, 0x6b, 0xa3, 0x68, 0xa4, 0x4c, 0xee, 0x18, 0xb5,
+    0x0c, 0x4c, 0x54, 0xb1, 0x94, 0xa4, 0xa0, 0x69, 0x25, 0x33, 0x4f, 0x7c, 0x82, 0x78, 0x46, 0xdf,
+    0x47, 0xad, 0xea, 0x02, 0x49, 0x1b, 0x6b, 0xae, 0xfa, 0xb6, 0xc2, 0x2b, 0xe2, 0x99, 0x68, 0xdc,
+    0x57, 0x5f, 0x23, 0xba, 0x26, 0x75, 0xf5, 0x64, 0xd5, 0xd5, 0x3d, 0xb7, 0x4f, 0x52, 0xd6, 0x15,
+    0x8d, 0xa2, 0x4f, 0x32, 0x0d, 0xf5, 0x54, 0x7a, 0xc7, 0x68, 0xf6, 0x9d, 0x83, 0xe3, 0x9d, 0xdf,
+    0xae, 0x4e, 0x4e, 0x8f, 0x3f, 0xed, 0x8d, 0xa1, 0xc3, 0x1b, 0xb3, 0xf7, 0xd3, 0xf9, 0xe9, 0xf8,
+    0x0c, 0x9d, 0xaf, 0x47, 0x8e, 0xf1, 0x1f, 0x80, 0xc7, 0x1f, 0xcb, 0x10, 0x50, 0x10, 0x85, 0xd0,
+    0x44, 0x64, 0x8e, 0x7f, 0x8d, 0x58, 0xc9, 0x50, 0x1c, 0xe5, 0x50, 0x18, 0xcf, 0x0c, 0x01, 0xfb,
+    0x47, 0x67, 0x7b, 0xa7, 0x9f, 0xb7, 0x0f, 0xae, 0x0e, 0x49, 0xf6, 0xeb, 0x7e, 0xbf, 0x3f, 0x92,
+    0x02, 0xf2, 0x1b, 0x11, 0x3b, 0xd8, 0x48, 0x07, 0x07, 0xc4, 0xe1, 0x60, 0x0b, 0x0f, 0x66, 0xc6,
+    0xf3, 0xf1, 0xd5, 0x97, 0xd3, 0xed, 0x13, 0x90, 0x6f, 0xae, 0xbf, 0xdd, 0x7c, 0xbb, 0xf5, 0xe3,
+    0xfa, 0xdb, 0xad, 0x51, 0x39, 0xf3, 0x3c, 0x9c, 0xa6, 0x49, 0x06, 0xdb, 0xdd, 0xa5, 0xfe, 0x22,
+    0x73, 0x70, 0x20, 0xd3, 0x7b, 0xe7, 0x7f, 0x7f, 0x1c, 0x60, 0x20, 0x5e, 0xe2, 0xb8, 0xca, 0x83,
+    0x1f, 0x25, 0xd3, 0xaf, 0x63, 0x7f, 0xbe, 0x88, 0x04, 0x61, 0x9d, 0x0b, 0x8d, 0xa1, 0xa8, 0xfb,
+    0xf8, 0xfa, 0x1a, 0x9e, 0xcf, 0x68, 0x29, 0x8a, 0x46, 0xe6, 0xa2, 0x02, 0x71, 0x1b, 0x4e, 0x85,
+    0x33, 0xcf, 0x9c, 0x2e, 0xa9, 0x05, 0x80, 0x00, 0x8b, 0x4e, 0x45, 0x2f, 0xa6, 0x2d, 0x2e, 0x05,
+    0x9c, 0x85, 0x73, 0x0e, 0xca, 0xcc, 0x5f, 0x3a, 0x21, 0x1b, 0x63, 0x87, 0x08, 0xbc, 0x7a, 0x8c,
+    0xad, 0xee, 0x0e, 0x0b, 0xc2, 0xaf, 0x7c, 0x58, 0x9f, 0x49, 0x45, 0x8a, 0x42, 0x30, 0x57, 0x6e,
+    0x2c, 0x78, 0x7c, 0x1f, 0x4f, 0x0b, 0xaf, 0x99, 0x2c, 0xd3, 0x2c, 0x67, 0xe8, 0xd2, 0x6a, 0x58,
+    0x6e, 0xc3, 0x52, 0xd1, 0x27, 0xfc, 0x74, 0x5f, 0xd9, 0xda, 0x2b, 0xd7, 0xd2, 0x56, 0xe4, 0x7a,
+    0x61, 0xe0, 0x29, 0xa8, 0x6c, 0x6f, 0x35, 0xd7, 0x28, 0x43, 0xea, 0xea, 0xaa, 0xd2, 0x03, 0x01,
+    0xd5, 0xf0, 0x19, 0xce, 0x61, 0xff, 0xc1, 0x74, 0xe5, 0x04, 0x9d, 0xba, 0x07, 0xc9, 0x00, 0xda,
+    0x71, 0xd6, 0xfb, 0xfd, 0xaa, 0x85, 0x92, 0x85, 0x6d, 0xa0, 0x97, 0xce, 0xad, 0x0d, 0x53, 0x37,
+    0x96, 0x21, 0x5e, 0xfa, 0xc5, 0x61, 0xe6, 0x2d, 0x33, 0x9d, 0xd4, 0x2c, 0x8e, 0xf7, 0x92, 0x47,
+    0xe7, 0x1e, 0x67, 0x99, 0x39, 0x6b, 0x88, 0xc4, 0xf0, 0x75, 0xde, 0x28, 0xc1, 0xdb, 0xe4, 0xd5,
+    0xf7, 0x79, 0xd5, 0x74, 0xc8, 0xb6, 0xf3, 0x83, 0xe2, 0x51, 0x52, 0x30, 0x1b, 0x28, 0x0e, 0xfd,
+    0xfc, 0xa6, 0x97, 0x26, 0x4b, 0x38, 0x93, 0x47, 0x82, 0xba, 0x0e, 0x29, 0xb1, 0xa6, 0x4f, 0x09,
+    0x71, 0x15, 0x5f, 0xf5, 0xa4, 0x86, 0xea, 0x49, 0x2c, 0x77, 0x6b, 0x9e, 0xcd, 0xb4, 0xdf, 0xc4,
+    0x8c, 0x0b, 0x6b, 0xda, 0x28, 0x94, 0x9c, 0xb3, 0x05, 0x40, 0xd2, 0xc5, 0x39, 0x98, 0xf5, 0x72,
+    0x05, 0x65, 0x3c, 0x1a, 0xf8, 0x00, 0x67, 0x6b, 0x97, 0x19, 0xd6, 0xf4, 0xba, 0xde, 0x62, 0x99,
+    0xdd, 0xc0, 0xdd, 0x41, 0x36, 0xa4, 0x8f, 0x8e, 0x93, 0xf0, 0xaa, 0x86, 0xa5, 0xf1, 0x48, 0x1c,
+    0xe9, 0xde, 0x75, 0xf8, 0x6b, 0x8e, 0xc5, 0x91, 0xd0, 0x35, 0x67, 0x5d, 0x7a, 0x7c, 0x61, 0x56,
+    0x2d, 0x52, 0xa5, 0xea, 0x0f, 0x56, 0x84, 0x6a, 0x5b, 0x67, 0xbb, 0x97, 0xdd, 0x84, 0xd7, 0xb9,
+    0x56, 0x7e, 0x22, 0x2d, 0x6d, 0x12, 0x5c, 0xf4, 0x4d, 0xa4, 0x1f, 0x62, 0x74, 0x30, 0xc2, 0x9f,
+    0x77, 0x4e, 0xc3, 0x4c, 0x18, 0x90, 0x90, 0xbf, 0xaa, 0xc9, 0x45, 0x78, 0xd9, 0x23, 0x55, 0xdf,
+    0xf1, 0x0c, 0xf4, 0xb5, 0xdd, 0x38, 0x57, 0x78, 0x49, 0xb6, 0xb7, 0x9d, 0x89, 0x39, 0xa4, 0x2d,
+    0x34, 0x3c, 0x1f, 0xef, 0xef, 0xee, 0x9d, 0x1d, 0x1f, 0xed, 0x5d, 0x1d, 0xec, 0x7d, 0xde, 0xa3,
+    0xaa, 0xa8, 0xdf, 0xdb, 0x18, 0xd9, 0x23, 0xa7, 0xdb, 0x87, 0x27, 0x3c, 0xd0, 0xef, 0x6f, 0x8e,
+    0x8a, 0xf8, 0x94, 0x75, 0x00, 0xa1, 0x05, 0x82, 0x1e, 0x82, 0x27, 0x81, 0x69, 0x84, 0x5a, 0x28,
+    0x80, 0x40, 0xdc, 0x45, 0x1a, 0x16, 0x2c, 0xe1, 0xd7, 0xfd, 0x33, 0x1c, 0x97, 0xab, 0x2f, 0xfb,
+    0x47, 0xbb, 0xc7, 0x5f, 0x20, 0x61, 0x63, 0xdd, 0x8a, 0x70, 0x04, 0x4d, 0x90, 0x02, 0x50, 0x02,
+    0x99, 0xd4, 0x87, 0xdb, 0xa7, 0x3f, 0xef, 0x1f, 0xc9, 0x10, 0xbd, 0xae, 0x9c, 0x56, 0x0f, 0xe9,
+    0xfe, 0xcd, 0x4a, 0xff, 0xf6, 0x3f, 0x64, 0xff, 0x96, 0xf6, 0xf2, 0x32, 0x5b, 0x13, 0xd0, 0xf0,
+    0xa3, 0x4c, 0xc8, 0x7e, 0x7f, 0x19, 0x84, 0xc9, 0x4e, 0xfe, 0xad, 0x38, 0x58, 0xb2, 0xa4, 0x00,
+    0x61, 0x36, 0xad, 0xf5, 0xfd, 0xec, 0x87, 0xb1, 0xd5, 0xe9, 0xa7, 0x69, 0x88, 0x13, 0x7c, 0xe0,
+    0xcf, 0x8c, 0x30, 0x4e, 0xc8, 0x21, 0x59, 0x02, 0x86, 0x49, 0x04, 0x31, 0x78, 0xdd, 0xb7, 0x16,
+    0x39, 0xcf, 0x0a, 0x79, 0x3f, 0xc1, 0x2e, 0xb2, 0xba, 0xb3, 0xff, 0x03, 0x15, 0xeb, 0xe5, 0xe4,
+    0x88, 0x03, 0x6c, 0xce, 0x18, 0xe9, 0xbf, 0x34, 0x8f, 0x33, 0x87, 0x64, 0x8e, 0xbb, 0x46, 0x90,
+    0x29, 0xe1, 0x92, 0x97, 0xc4, 0x1c, 0xe2, 0xcd, 0x25, 0x27, 0x38, 0x11, 0xd6, 0x45, 0x89, 0x81,
+    0x37, 0xcc, 0xb1, 0x26, 0xb4, 0x01, 0xe9, 0x40, 0x1a, 0xc7, 0x31, 0xa3, 0x0c, 0xb8, 0x4e, 0x23,
+    0xc2, 0xc8, 0x91, 0xe7, 0xbe, 0x3b, 0x70, 0x2e, 0x3f, 0x1a, 0xe7, 0x49, 0xea, 0xcf, 0x44, 0x8f,
+    0x22, 0x67, 0x2e, 0xe6, 0xe5, 0xe5, 0x09, 0x32, 0x8a, 0x94, 0x35, 0x60, 0x51, 0x7d, 0x94, 0x22,
+    0xce, 0x83, 0x33, 0xf5, 0x21, 0x45, 0x22, 0x72, 0x67, 0xed, 0x07, 0x24, 0x2a, 0x98, 0x34, 0x47,
+    0x9e, 0x4b, 0x02, 0xe1, 0xfc, 0xb0, 0xe6, 0xc8, 0x3a, 0x61, 0x45, 0xaf, 0x09, 0x87, 0x61, 0x2a,
+    0x8a, 0x95, 0xf6, 0x6b, 0x05, 0xc5, 0x8a, 0xde, 0x51, 0x1d, 0x50, 0xe4, 0xe6, 0xde, 0x85, 0x31,
+    0x6a, 0x80, 0xde, 0x36, 0x0f, 0xd2, 0xca, 0x60, 0x4f, 0x80, 0x38, 0xd5, 0x7d, 0x27, 0x26, 0x5f,
+    0xc3, 0xdc, 0x1c, 0x54, 0x81, 0x85, 0xe5, 0xe8, 0x09, 0x4c, 0x5f, 0x11, 0x77, 0x24, 0x98, 0x17,
+    0x5e, 0x38, 0x8b, 0x1e, 0x57, 0xd5, 0x27, 0x3a, 0xc3, 0x28, 0xf2, 0x61, 0x0c, 0x4d, 0xa6, 0xfc,
+    0xa7, 0x42, 0x47, 0xbd, 0x26, 0x45, 0x6f, 0x46, 0x1f, 0xb7, 0xea, 0xda, 0xae, 0x5f, 0xcc, 0xd0,
+    0xa3, 0x64, 0x4d, 0xa5, 0x65, 0x16, 0xc6, 0xb2, 0x44, 0x95, 0xdd, 0x04, 0x72, 0x97, 0xb0, 0xca,
+    0x7d, 0xc1, 0xf3, 0x2c, 0x04, 0xd7, 0xac, 0x0a, 0x14, 0x79, 0x7a, 0x6a, 0x53, 0x0b, 0x3d, 0x56,
+    0x68, 0x1b, 0x20, 0x56, 0x84, 0xb1, 0x4f, 0xde, 0x66, 0x88, 0x60, 0x37, 0x94, 0x10, 0x93, 0x2c,
+    0x56, 0x50, 0xa3, 0x3f, 0x57, 0xc5, 0x52, 0xb6, 0xcc, 0xa8, 0xc0, 0x15, 0x01, 0xea, 0xa5, 0x62,
+    0x3c, 0x15, 0x19, 0xea, 0x35, 0xaf, 0x92, 0x29, 0x1b, 0x31, 0xbf, 0x8a, 0x79, 0x6a, 0xc6, 0xb6,
+    0x53, 0x5f, 0x38, 0xf8, 0xb8, 0xa0, 0xd8, 0xce, 0x29, 0x73, 0x32, 0x57, 0xc7, 0x30, 0xb3, 0x2c,
+    0x4f, 0x69, 0xc8, 0x9e, 0x8e, 0x29, 0xa8, 0x7b, 0x3b, 0xe7, 0xfc, 0x77, 0x98, 0x69, 0xa7, 0xc9,
+    0x33, 0x73, 0x9f, 0x50, 0xfe, 0x1d, 0x2f, 0x73, 0xd4, 0x3d, 0x44, 0x8b, 0x85, 0xcd, 0x17, 0x70,
+    0xe2, 0x27, 0x46, 0x91, 0x3c, 0x87, 0x2a, 0x4a, 0xb0, 0xe2, 0x19, 0x95, 0x72, 0x39, 0xb2, 0x50,
+    0x99, 0xd5, 0x58, 0x19, 0x4c, 0xa6, 0xb2, 0x29, 0x06, 0xa7, 0xd2, 0xf1, 0x68, 0x00, 0xb9, 0x47,
+    0xe9, 0x83, 0x74, 0xd4, 0xc4, 0x57, 0xa6, 0x52, 0xc5, 0xdf, 0xb4, 0x56, 0x4b, 0x4a, 0x2d, 0xa1,
+    0x36, 0xe6, 0x63, 0x0a, 0x5d, 0x3b, 0x74, 0xdf, 0xcf, 0x9b, 0xaa, 0xb2, 0x32, 0x1f, 0x04, 0x23,
+    0x98, 0xe0, 0xd8, 0x14, 0x87, 0x8c, 0x7e, 0x34, 0x81, 0x0d, 0x26, 0xa2, 0x3c, 0xba, 0xf0, 0x73,
+    0x04, 0xac, 0xd8, 0x2e, 0x7c, 0xd9, 0x67, 0x0e, 0xc9, 0xc4, 0x56, 0xfa, 0xe5, 0xee, 0x2b, 0x99,
+    0x84, 0x0d, 0xa1, 0x38, 0x78, 0x45, 0x98, 0x95, 0x89, 0xbc, 0x8e, 0x55, 0xba, 0x5a, 0xa6, 0xca,
+    0xd4, 0x06, 0x47, 0x91, 0xa7, 0xad, 0xe4, 0xd3, 0x36, 0x62, 0xb7, 0x9d, 0xa6, 0x65, 0xb9, 0x0f,
+    0xdd, 0x18, 0xdb, 0xcc, 0xfd, 0x6f, 0x74, 0x3f, 0x13, 0xdd, 0x7b, 0xb4, 0xac, 0x8e, 0xc1, 0x45,
+    0x00, 0xa9, 0x9a, 0xa1, 0x70, 0x2c, 0x6c, 0x6e, 0x9c, 0x6c, 0x2b, 0x25, 0x75, 0x0a, 0xa9, 0x9e,
+    0x95, 0xc2, 0x3a, 0x6a, 0xda, 0x36, 0xd5, 0xc7, 0x76, 0xfe, 0x50, 0x12, 0x3f, 0xd8, 0x79, 0xe5,
+    0xa3, 0xea, 0x6f, 0x0d, 0xed, 0x7e, 0xec, 0xb9, 0x62, 0xe8, 0x5a, 0x03, 0x84, 0xc4, 0x90, 0xaf,
+    0x5f, 0xab, 0x35, 0x6a, 0xef, 0x56, 0xce, 0xaf, 0x37, 0x64, 0xd5, 0xe6, 0xc1, 0x72, 0x0c, 0x3b,
+    0x78, 0x79, 0xe7, 0x31, 0x3f, 0x23, 0x24, 0xf0, 0xba, 0x53, 0xe4, 0x34, 0x65, 0xc9, 0x80, 0x9f,
+    0x78, 0xd0, 0xce, 0xe2, 0xdb, 0x95, 0x84, 0x9d, 0x62, 0x4b, 0x8e, 0xcd, 0xf8, 0x2e, 0xcd, 0x08,
+    0x78, 0x15, 0x1c, 0xd4, 0x97, 0x38, 0xc8, 0x70, 0xa1, 0x2a, 0x0c, 0xe2, 0xeb, 0x62, 0x11, 0xab,
+    0x19, 0x34, 0x11, 0xe5, 0x48, 0x2c, 0x28, 0x6c, 0xcb, 0xd0, 0xd3, 0x75, 0x61, 0xa9, 0x0d, 0xac,
+    0x9d, 0x74, 0x19, 0xd2, 0xa7, 0x02, 0x92, 0x74, 0x86, 0x8d, 0x4d, 0xb2, 0xa0, 0x4d, 0x87, 0xe5,
+    0xae, 0x39, 0x9b, 0x58, 0xc7, 0xac, 0x1a, 0x5b, 0xfa, 0x58, 0x26, 0xf7, 0x47, 0x88, 0xc2, 0x7e,
+    0x7a, 0x0a, 0x41, 0x67, 0x89, 0x49, 0x60, 0xe3, 0x27, 0x50, 0x13, 0x92, 0x04, 0x55, 0x93, 0xb0,
+    0x26, 0x5a, 0x9a, 0xbb, 0x5b, 0x72, 0x3c, 0x36, 0x4d, 0xbf, 0xa0, 0xe6, 0x6d, 0x5a, 0x7d, 0xcf,
+    0x8c, 0xab, 0x72, 0x89, 0x0f, 0x2d, 0x03, 0x5e, 0xe4, 0x76, 0x88, 0xad, 0x64, 0xd0, 0x80, 0x76,
+    0xfa, 0xb0, 0xa8, 0x1c, 0x8c, 0xf4, 0x69, 0x9e, 0x58, 0xcb, 0x0f, 0xaa, 0x61, 0xb3, 0x5a, 0x36,
+    0x68, 0x91, 0x8f, 0x86, 0x60, 0x3b, 0xd3, 0x4d, 0x89, 0x39, 0x1a, 0x03, 0x8f, 0x04, 0xcb, 0x48,
+    0x04, 0xbc, 0xc8, 0xcc, 0xcb, 0x6b, 0x74, 0xcd, 0x1b, 0x61, 0xe1, 0x28, 0x2c, 0xd4, 0x06, 0x39,
+    0x2f, 0xbe, 0xe8, 0x30, 0xe1, 0x53, 0x23, 0x4e, 0x32, 0xae, 0x24, 0xee, 0x32, 0x0b, 0x04, 0xa6,
+    0xcb, 0x38, 0x26, 0xac, 0x6b, 0xe1, 0xca, 0x2f, 0x63, 0xaa, 0x08, 0xce, 0x8e, 0xaf, 0x3e, 0xef,
+    0x9d, 0x8e, 0xf7, 0x8f, 0x8f, 0x08, 0xbb, 0xca, 0x91, 0xdd, 0xfd, 0xd3, 0xbd, 0x9d, 0x33, 0x74,
+    0x11, 0x3e, 0xbd, 0x70, 0x31, 0x31, 0x3d, 0x6e, 0x59, 0x2e, 0xe8, 0x93, 0xaf, 0x29, 0x15, 0x8c,
+    0x04, 0xd5, 0xf1, 0xe9, 0x2e, 0x3c, 0x83, 0x78, 0x2f, 0xb0, 0xda, 0x37, 0xfc, 0x7f, 0x1c, 0xb3,
+    0x2d, 0xfe, 0x1c, 0x6c, 0xe2, 0x8f, 0xa2, 0x9d, 0x24, 0x49, 0xbe, 0x1f, 0x58, 0x5a, 0x45, 0x7e,
+    0x96, 0x8f, 0xf9, 0x42, 0xce, 0xd0, 0x54, 0xd0, 0xf1, 0x3e, 0x8f, 0xf3, 0x30, 0x92, 0xe6, 0x2a,
+    0xaf, 0xa8, 0x06, 0x5b, 0x5e, 0xd0, 0x71, 0x42, 0xc2, 0x60, 0x2a, 0xa5, 0x04, 0x94, 0xd8, 0xce,
+    0xc3, 0x38, 0xc7, 0x50, 0x08, 0x5b, 0xa7, 0x4b, 0x41, 0x70, 0xcd, 0xe0, 0x59, 0xdf, 0x7c, 0x09,
+    0x8f, 0xf3, 0x97, 0xe3, 0x15, 0xfd, 0x6f, 0xbc, 0x10, 0x0e, 0x82, 0x92, 0xea, 0xdd, 0x3b, 0x67,
+    0xb0, 0x65, 0xcb, 0x9b, 0x27, 0x40, 0x2d, 0x27, 0xf2, 0x1c, 0x7b, 0x70, 0xd2, 0x8e, 0x33, 0x09,
+    0xf3, 0xc2, 0x31, 0xf9, 0xa8, 0xd3, 0xd5, 0x72, 0x51, 0xc7, 0xba, 0x8e, 0x3b, 0x2a, 0x86, 0x3e,
+    0x38, 0x5b, 0xe5, 0x80, 0x7a, 0x32, 0x90, 0x55, 0x1f, 0xe9, 0x50, 0x60, 0x91, 0xc7, 0x8b, 0xcb,
+    0xac, 0x0f, 0x32, 0xcc, 0x74, 0xbb, 0xec, 0x00, 0x74, 0x84, 0x3c, 0x9a, 0xd1, 0xf9, 0xf0, 0x81,
+    0x16, 0xf5, 0xca, 0x19, 0x10, 0x54, 0xed, 0x32, 0x54, 0xed, 0xb9, 0x46, 0xb2, 0xcd, 0x2a, 0xe5,
+    0xf7, 0x14, 0x48, 0xf5, 0x27, 0x1c, 0x58, 0xe1, 0x4d, 0x96, 0xd7, 0x3a, 0x34, 0x21, 0x28, 0x99,
+    0x77, 0x3b, 0xa8, 0xb1, 0xa4, 0xc9, 0xef, 0x6e, 0x70, 0x00, 0x1d, 0x8f, 0x7e, 0xa3, 0x60, 0x5b,
+    0x5e, 0xf7, 0x26, 0xf7, 0xb9, 0x38, 0xe0, 0xd0, 0x66, 0x47, 0xb5, 0x72, 0xff, 0x2f, 0x08, 0x6d,
+    0xee, 0xfa, 0xb9, 0xff, 0x39, 0x14, 0x77, 0x34, 0x07, 0x97, 0xaf, 0xf0, 0x80, 0x76, 0x69, 0xd6,
+    0x3e, 0x29, 0xdc, 0xff, 0xd6, 0xff, 0xe9, 0x52, 0x21, 0x57, 0x12, 0x82, 0x24, 0x4c, 0xf3, 0xc8,
+    0x98, 0xf2, 0xa1, 0x36, 0xdb, 0x04, 0xf0, 0xf3, 0xeb, 0x48, 0x6b, 0xcb, 0xd9, 0x98, 0x96, 0x72,
+    0x8a, 0xcf, 0x34, 0xf0, 0x1e, 0x99, 0x94, 0x02, 0x8e, 0x4a, 0xb2, 0x8c, 0x0f, 0x68, 0x9d, 0x32,
+    0x2b, 0xd3, 0xcf, 0x51, 0x8b, 0x27, 0x64, 0x33, 0x1b, 0x16, 0x23, 0xa2, 0x06, 0xa3, 0xa9, 0x99,
+    0x82, 0x02, 0x75, 0x71, 0x1d, 0x15, 0x98, 0xab, 0x92, 0xea, 0x5d, 0x47, 0x3e, 0x5b, 0x93, 0x08,
+    0xb0, 0x3b, 0x9b, 0xa8, 0x57, 0xee, 0x42, 0xae, 0x1a, 0xa8, 0x47, 0x2e, 0x9c, 0xef, 0x55, 0xfc,
+    0x4c, 0xd0, 0x8f, 0xc1, 0x50, 0xcf, 0xfc, 0xbd, 0xa5, 0xaf, 0xb8, 0x90, 0x18, 0xae, 0x32, 0x84,
+    0x02, 0xb7, 0xd3, 0x92, 0x57, 0xe0, 0xe3, 0x3c, 0xc5, 0xb1, 0x05, 0x8a, 0x4c, 0xe6, 0x84, 0x79,
+    0x76, 0xa0, 0x90, 0xe9, 0xa8, 0x83, 0x76, 0xbb, 0xd3, 0x52, 0x69, 0x65, 0x68, 0x3b, 0xa7, 0x41,
+    0xb5, 0x8e, 0x28, 0x67, 0xfc, 0xdc, 0x20, 0x26, 0x80, 0xd2, 0xa5, 0xb8, 0x0a, 0x10, 0x72, 0x86,
+    0xe6, 0xd8, 0x26, 0x86, 0x82, 0x65, 0xca, 0x00, 0x1a, 0xd9, 0x70, 0xa8, 0x0f, 0xd0, 0xeb, 0x76,
+    0xeb, 0x61, 0x54, 0xa8, 0xbe, 0x3e, 0x54, 0x47, 0x35, 0x5b, 0x46, 0x14, 0x75, 0x8b, 0x05, 0xc8,
+    0x1e, 0xd2, 0x3e, 0x41, 0x2c, 0x9d, 0x42, 0xb6, 0x27, 0xcd, 0x02, 0x47, 0x6d, 0x3b, 0x2b, 0x74,
+    0x34, 0x3a, 0x4c, 0x1b, 0xbc, 0x6c, 0x69, 0xe2, 0xdb, 0x02, 0x52, 0x5e, 0x40, 0xbd, 0xce, 0x86,
+    0x48, 0x93, 0xc9, 0xd0, 0x5e, 0x69, 0xa7, 0x85, 0xe2, 0x86, 0xe0, 0xf7, 0x95, 0x7f, 0x3b, 0xbb,
+    0x9a, 0xd3, 0x82, 0x64, 0x14, 0xd9, 0xe2, 0x05, 0x91, 0x87, 0x68, 0x05, 0xd7, 0xdb, 0x6a, 0x41,
+    0x3d, 0xcd, 0x32, 0xa7, 0xed, 0x54, 0xf4, 0x9b, 0x45, 0x11, 0xa7, 0xa8, 0x4a, 0x6b, 0x6c, 0xd4,
+    0x37, 0x92, 0x5f, 0x30, 0xb9, 0xd2, 0x61, 0xbc, 0xc5, 0x3f, 0x2d, 0xcd, 0x06, 0x64, 0x67, 0x06,
+    0x1c, 0x85, 0x89, 0xd7, 0xb9, 0x8b, 0xac, 0x06, 0xdb, 0x0f, 0x8d, 0x10, 0x7c, 0xa1, 0x35, 0xdc,
+    0xb8, 0xa4, 0xd3, 0xc2, 0xd1, 0xd8, 0xdc, 0x8d, 0xcd, 0x86, 0xf9, 0x45, 0x96, 0x41, 0x0a, 0x4d,
+    0x4d, 0x25, 0x8e, 0xbd, 0x0d, 0x08, 0x18, 0x8c, 0xa5, 0x50, 0xeb, 0x50, 0xd8, 0xa0, 0x9b, 0x3f,
+    0x6c, 0xc8, 0xa3, 0x6a, 0x4a, 0xa7, 0xac, 0x0d, 0xad, 0xd7, 0x57, 0xb0, 0x61, 0x39, 0xc9, 0xeb,
+    0x52, 0xad, 0xf2, 0x0a, 0x97, 0xcb, 0x87, 0xab, 0x28, 0xc9, 0x28, 0xa1, 0x34, 0xce, 0xe7, 0xd4,
+    0xcc, 0xe2, 0x18, 0x42, 0xb7, 0x1e, 0x3b, 0x34, 0xb4, 0xa0, 0xff, 0xfe, 0xa9, 0xd1, 0xe8, 0xdf,
+    0x50, 0x7a, 0x63, 0xdd, 0xdb, 0x54, 0x59, 0xa4, 0x66, 0x90, 0x37, 0xe8, 0x9a, 0xf9, 0x0b, 0xb3,
+    0x6b, 0x30, 0xb0, 0x8c, 0xf4, 0x63, 0xdd, 0x48, 0x99, 0xf8, 0x83, 0x6c, 0x43, 0x8f, 0x86, 0xcc,
+    0x49, 0x06, 0x3a, 0x55, 0x3d, 0x18, 0x31, 0xab, 0x76, 0xcf, 0xaa, 0x0b, 0x62, 0x9d, 0x91, 0xee,
+    0x38, 0x37, 0xdd, 0x65, 0xbd, 0x24, 0xe6, 0x07, 0xac, 0x45, 0xaa, 0xe5, 0x2e, 0x91, 0xa6, 0x49,
+    0x6a, 0x76, 0x31, 0x0d, 0x15, 0x19, 0x06, 0x7c, 0x90, 0x37, 0x6e, 0x37, 0x09, 0x5f, 0xd6, 0xa9,
+    0xbb, 0x08, 0xba, 0x42, 0xa1, 0xf9, 0x7a, 0xd4, 0x1d, 0xd3, 0x13, 0x47, 0x72, 0xcc, 0xc1, 0xdb,
+    0xf5, 0xde, 0x60, 0xeb, 0x4d, 0x6f, 0xb3, 0x37, 0xd0, 0xef, 0x83, 0x25, 0x69, 0x13, 0x17, 0x77,
+    0x13, 0xc7, 0x9b, 0xbe, 0xab, 0xe7, 0x42, 0x24, 0xff, 0x22, 0x26, 0x63, 0x54, 0x54, 0x22, 0xf7,
+    0xdc, 0xbb, 0x6c, 0xb8, 0xb6, 0xe6, 0x22, 0x2b, 0xf0, 0xbc, 0xab, 0x8e, 0x3b, 0xa4, 0x1f, 0xcc,
+    0x87, 0x1f, 0x6b, 0x77, 0x99, 0xcb, 0x4a, 0xf6, 0x26, 0x28, 0xf6, 0xd3, 0xfb, 0x33, 0x75, 0xe9,
+    0x80, 0xc2, 0xc7, 0xbf, 0x47, 0x1a, 0xb8, 0x16, 0xa9, 0xab, 0x96, 0x98, 0x2c, 0x38, 0x51, 0xd5,
+    0x80, 0xd4, 0x8e, 0x34, 0x94, 0x08, 0x3c, 0x09, 0x1a, 0xe4, 0x22, 0x45, 0x14, 0x25, 0x14, 0xcf,
+    0xf4, 0x5e, 0x70, 0x07, 0x76, 0x03, 0x91, 0x25, 0x4f, 0xe8, 0x89, 0x50, 0x48, 0x4f, 0x68, 0x6f,
+    0x45, 0x9a, 0xf1, 0x19, 0xad, 0x01, 0x28, 0x15, 0x52, 0x14, 0xd4, 0x59, 0xd1, 0x85, 0x26, 0x2a,
+    0x6b, 0x0d, 0x75, 0x56, 0x8a, 0x9b, 0xee, 0xef, 0x2d, 0x96, 0xde, 0x23, 0x62, 0xba, 0xe5, 0x64,
+    0x9e, 0x91, 0xea, 0xcc, 0x18, 0x15, 0x29, 0x26, 0x86, 0x8c, 0xf4, 0x2c, 0x84, 0xc7, 0xe8, 0xb1,
+    0x55, 0xe5, 0x71, 0xc6, 0x88, 0x5c, 0xca, 0xda, 0xe4, 0x27, 0xd6, 0xcb, 0x00, 0x90, 0x85, 0x58,
+    0x37, 0xfe, 0xd6, 0x9e, 0x83, 0x81, 0xf0, 0x2b, 0x8a, 0x2c, 0x4f, 0x79, 0x14, 0x3f, 0x32, 0xe8,
+    0x1b, 0x33, 0x69, 0xdf, 0xb1, 0x67, 0x32, 0x7d, 0x48, 0x53, 0xce, 0x11, 0x8c, 0xfc, 0x99, 0xad,
+    0x15, 0x3f, 0x04, 0x36, 0x61, 0x88, 0xba, 0x85, 0x80, 0xd9, 0x93, 0x6b, 0x87, 0x47, 0xf9, 0x21,
+    0x3a, 0xdb, 0xcb, 0xcd, 0xf8, 0x3c, 0xbb, 0x44, 0xaf, 0x20, 0x8b, 0x09, 0x68, 0x4a, 0x6a, 0x9a,
+    0xd4, 0x11, 0x58, 0x1e, 0x45, 0x07, 0xbe, 0xeb, 0x53, 0xe4, 0xbf, 0x8e, 0x8f, 0x8f, 0x7a, 0x7c,
+    0xe3, 0x64, 0x51, 0x57, 0x2e, 0xf6, 0x54, 0x31, 0xa1, 0x6f, 0xf3, 0xb6, 0xc9, 0x9b, 0x7a, 0x61,
+    0xc6, 0x7f, 0x09, 0x39, 0x64, 0xed, 0x76, 0x01, 0x99, 0xe8, 0x2f, 0xdf, 0x55, 0x3f, 0x52, 0x11,
+    0x56, 0x6e, 0xc4, 0x91, 0x09, 0x82, 0x48, 0x1c, 0x4a, 0x4b, 0xb0, 0xac, 0x8b, 0xf0, 0x52, 0xda,
+    0xc8, 0xba, 0x5a, 0xc2, 0x26, 0x27, 0x93, 0x7f, 0x97, 0xa7, 0x97, 0x5c, 0x07, 0x46, 0x04, 0x08,
+    0x0a, 0xee, 0xc7, 0xc5, 0x6d, 0x55, 0x71, 0x50, 0x7a, 0xc7, 0x27, 0x7b, 0x47, 0xca, 0xee, 0xcc,
+    0xcc, 0x0b, 0x95, 0xe6, 0x0a, 0xaf, 0xef, 0x59, 0x96, 0x7c, 0xe4, 0x63, 0xdd, 0x5f, 0x95, 0xce,
+    0xc0, 0xe9, 0x41, 0xef, 0xc3, 0x34, 0xa2, 0xa5, 0xc9, 0x4b, 0xb1, 0x8f, 0x4e, 0xf1, 0xb6, 0x9f,
+    0x0e, 0x2a, 0x2a, 0x5f, 0x14, 0xef, 0x0f, 0x22, 0x8a, 0xc9, 0x57, 0x07, 0xad, 0xd7, 0x54, 0x20,
+    0xa4, 0x18, 0xd0, 0xef, 0x14, 0xd6, 0x09, 0x0c, 0x7d, 0x6a, 0xa6, 0x29, 0xde, 0x5b, 0xe2, 0x4a,
+    0x40, 0x56, 0x2d, 0xd5, 0xe3, 0x63, 0x1e, 0xa9, 0x77, 0x66, 0xcd, 0x50, 0xa2, 0x2e, 0x7e, 0x42,
+    0x02, 0x7f, 0x2a, 0x30, 0x97, 0x3a, 0xcd, 0xc3, 0x56, 0x51, 0x89, 0x10, 0x09, 0xfd, 0xa0, 0xd4,
+    0x6e, 0x56, 0x1d, 0xd4, 0x2f, 0xef, 0xfe, 0x64, 0x85, 0x2e, 0x47, 0xa9, 0x4c, 0xe7, 0x2b, 0x20,
+    0xcc, 0xc9, 0xaf, 0x8d, 0x14, 0x4f, 0x71, 0x58, 0x3a, 0xc5, 0x6d, 0xc8, 0x96, 0x78, 0x55, 0x76,
+    0x19, 0xa9, 0x69, 0xd8, 0xaa, 0xdf, 0x5b, 0x8d, 0x2a, 0xd4, 0xfc, 0x40, 0x73, 0xd8, 0x32, 0x1f,
+    0x38, 0x55, 0x48, 0x14, 0xbe, 0x1a, 0x4a, 0x07, 0x2d, 0x0c, 0xd4, 0x26, 0xf0, 0x29, 0xd1, 0x6d,
+    0x4f, 0x21, 0xaf, 0x2a, 0xa7, 0x46, 0x04, 0x43, 0x8d, 0x8a, 0xad, 0xcb, 0x4f, 0x05, 0x07, 0x54,
+    0xac, 0x38, 0x95, 0xc5, 0xa2, 0x8e, 0x8c, 0x9a, 0xa1, 0x04, 0x02, 0xbc, 0x0d, 0xcb, 0x38, 0x10,
+    0xd7, 0x28, 0xfc, 0x19, 0x19, 0xdb, 0x2f, 0xe0, 0x16, 0x97, 0xbc, 0x36, 0x1b, 0x6d, 0xbb, 0xbc,
+    0x94, 0x67, 0x52, 0xa9, 0x05, 0xcb, 0xa3, 0x57, 0x15, 0x2a, 0xdc, 0xe6, 0x59, 0x36, 0x74, 0x2a,
+    0xa2, 0x57, 0xe5, 0x8a, 0xa0, 0x72, 0x27, 0xf4, 0x50, 0x59, 0xbd, 0x89, 0xc7, 0x86, 0xcd, 0x4a,
+    0xd4, 0x2c, 0x06, 0xfb, 0x2c, 0x33, 0xc3, 0x60, 0xaa, 0x86, 0x6e, 0x3b, 0x75, 0x13, 0xb1, 0x9e,
+    0x0d, 0x5a, 0xfe, 0xf7, 0x4d, 0x67, 0x4c, 0xa2, 0xde, 0xa9, 0xae, 0xcf, 0x60, 0xbd, 0x95, 0x6d,
+    0x4d, 0xa0, 0x46, 0xf4, 0xc5, 0x38, 0x77, 0xf1, 0xe9, 0xa9, 0xcb, 0xa8, 0xde, 0xd2, 0x6b, 0x09,
+    0xd4, 0xff, 0xc4, 0xfb, 0x32, 0xa5, 0xc8, 0xe2, 0xa5, 0x99, 0x72, 0x2e, 0xeb, 0x6d, 0xdc, 0xda,
+    0x94, 0x95, 0x97, 0x36, 0xaa, 0x0c, 0xf5, 0x5d, 0xb6, 0xe0, 0xe5, 0xf0, 0x49, 0x7b, 0xd5, 0xcf,
+    0x8e, 0xde, 0x32, 0x25, 0xb1, 0x54, 0x32, 0x53, 0x61, 0xc7, 0xd0, 0xad, 0xbc, 0xb7, 0x50, 0x04,
+    0xe5, 0x26, 0x70, 0x36, 0xaf, 0x90, 0x37, 0xc4, 0x9b, 0x07, 0x5d, 0x32, 0x66, 0x37, 0x8f, 0xbc,
+    0x0b, 0x21, 0xb5, 0xd2, 0xa7, 0xd9, 0x8a, 0xd0, 0xaa, 0x53, 0xbe, 0xd1, 0x03, 0xaa, 0xae, 0xea,
+    0xe0, 0xf0, 0x2c, 0x7b, 0xee, 0xd2, 0x04, 0x09, 0xd3, 0x78, 0xe3, 0x6c, 0x92, 0x04, 0xf7, 0x32,
+    0x0c, 0xd3, 0x35, 0x13, 0xa2, 0xdb, 0x3c, 0xb9, 0x15, 0x5e, 0x85, 0xbf, 0x63, 0xb3, 0x13, 0x2a,
+    0x4a, 0xc2, 0xc0, 0xb1, 0x85, 0xc8, 0x27, 0xb1, 0x5f, 0xc2, 0x00, 0xc9, 0xed, 0x51, 0xf9, 0x7e,
+    0x10, 0x78, 0x50, 0xb6, 0xad, 0xde, 0x98, 0xd0, 0x60, 0xa2, 0x5c, 0x30, 0xbd, 0xeb, 0x64, 0xae,
+    0xde, 0x40, 0x1c, 0x36, 0xa2, 0x78, 0x66, 0x05, 0x72, 0x92, 0x07, 0x14, 0x1f, 0xb5, 0x37, 0x1a,
+    0xca, 0xe3, 0x58, 0x64, 0xb9, 0xf2, 0x1a, 0x8c, 0xbb, 0x14, 0x92, 0xe2, 0x97, 0x23, 0xc3, 0xcc,
+    0x9f, 0x44, 0xfc, 0xa8, 0xb1, 0x18, 0xe2, 0x97, 0xfb, 0xcd, 0x91, 0x15, 0x35, 0x54, 0x7b, 0x6f,
+    0x4a, 0x3a, 0x99, 0x74, 0x30, 0x8a, 0x57, 0xf5, 0xe3, 0xac, 0x4e, 0xb1, 0xf5, 0x8f, 0x15, 0xcc,
+    0xa7, 0x60, 0x4d, 0x51, 0x40, 0x3d, 0x08, 0xd3, 0xff, 0x64, 0xa0, 0x72, 0xb2, 0x64, 0x38, 0xa1,
+    0x53, 0xf5, 0xe5, 0xe4, 0x10, 0xe8, 0xb8, 0x55, 0xca, 0x70, 0x3e, 0xa8, 0x51, 0x78, 0x88, 0xe3,
+    0x11, 0x72, 0x2e, 0x87, 0x88, 0x81, 0x5f, 0x62, 0x64, 0x6f, 0x71, 0xd9, 0x66, 0x85, 0x15, 0x1a,
+    0xae, 0x22, 0xe9, 0xe1, 0x78, 0xe3, 0x2b, 0x57, 0x3a, 0xdc, 0x98, 0x8f, 0xf2, 0xea, 0x81, 0x46,
+    0xad, 0xa1, 0xf8, 0xd7, 0x1d, 0x26, 0x79, 0xd6, 0xbc, 0xde, 0xff, 0xbf, 0x8d, 0x28, 0x7f, 0xf4,
+    0x9f, 0x7b, 0x9b, 0x4b, 0x95, 0x88, 0x5a, 0xef, 0xa1, 0xfe, 0x52, 0xd4, 0xa1, 0xfc, 0x47, 0xbe,
+    0x7b, 0xa8, 0xeb, 0xdd, 0x52, 0x0d, 0xfd, 0xba, 0x97, 0xf6, 0x8a, 0x97, 0x5a, 0xea, 0x39, 0x9d,
+    0x92, 0x85, 0x5b, 0xc8, 0xae, 0xbd, 0x86, 0x2a, 0x31, 0xac, 0x79, 0xed, 0x6b, 0x3d, 0xbb, 0x9e,
+    0xd5, 0x9e, 0x5d, 0xab, 0x27, 0x0a, 0x83, 0x17, 0x3e, 0xb4, 0x7e, 0xe2, 0x7d, 0xd4, 0xc7, 0x5e,
+    0xdf, 0xd5, 0xd0, 0xb4, 0x78, 0xb8, 0x06, 0x20, 0xf6, 0x9f, 0x3c, 0x4f, 0x6d, 0x4b, 0x90, 0xc8,
+    0xb5, 0x2a, 0xfd, 0xa4, 0xcf, 0xff, 0x03, 0x96, 0xc4, 0x44, 0xb9, 0x5f, 0x34, 0x00, 0x00,
+};
+
+// index.html: 2113 bytes minified, 810 gzipped
+static const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x56, 0x4d, 0x73, 0xdb, 0x36,
+    0x10, 0xbd, 0xe7, 0x57, 0x6c, 0x70, 0x6a, 0x27, 0xa6, 0x45, 0x7d, 0xc5, 0xf2, 0x8c, 0xa8, 0x4e,
+    0x92, 0xc6, 0xc9, 0xa1, 0xa9, 0x39, 0x63, 0x77, 0x3a, 0x39, 0x82, 0xe4, 0x4a, 0x44, 0x0d, 0x01,
+    0x0c, 0x00, 0x4a, 0x96, 0x7f, 0x7d, 0x17, 0x80, 0x28, 0xc9, 0xb2, 0xe5, 0x66, 0x92, 0x9e, 0x08,
+    0x2c, 0xde, 0xbe, 0xdd, 0x7d, 0xda, 0x05, 0x34, 0x7d, 0xfd, 0xfb, 0xf5, 0x87, 0xdb, 0xaf, 0xf9,
+    0x47, 0xa8, 0xdd, 0x52, 0xce, 0x5e, 0x4d, 0xfd, 0x07, 0x24, 0x57, 0x8b, 0x8c, 0xa1, 0x62, 0xde,
+    0x80, 0xbc, 0xa2, 0xcf, 0x12, 0x1d, 0x87, 0xb2, 0xe6, 0xc6, 0xa2, 0xcb, 0xd8, 0x5f, 0xb7, 0x57,
+    0xc9, 0x84, 0x75, 0x66, 0xc5, 0x97, 0x98, 0xb1, 0x95, 0xc0, 0x75, 0xa3, 0x8d, 0x63, 0x50, 0x6a,
+    0xe5, 0x50, 0x11, 0x6c, 0x2d, 0x2a, 0x57, 0x67, 0x15, 0xae, 0x44, 0x89, 0x49, 0xd8, 0x9c, 0x81,
+    0x50, 0xc2, 0x09, 0x2e, 0x13, 0x5b, 0x72, 0x89, 0x59, 0xff, 0x3c, 0x3d, 0x83, 0xd6, 0xa2, 0x09,
+    0x7b, 0x5e, 0x90, 0x49, 0x69, 0x4f, 0xec, 0x84, 0x93, 0x38, 0xfb, 0xa2, 0x29, 0x1e, 0xdc, 0x1a,
+    0x2e, 0x14, 0x9a, 0x69, 0x2f, 0x1a, 0x5f, 0x4d, 0xa5, 0x50, 0x77, 0x60, 0x50, 0x66, 0xcc, 0xba,
+    0x8d, 0x44, 0x5b, 0x23, 0x52, 0xd8, 0xda, 0xe0, 0x7c, 0x6b, 0x39, 0x2f, 0xad, 0xfd, 0x6d, 0x95,
+    0xa5, 0xe3, 0x72, 0x8c, 0xe3, 0xb4, 0x9a, 0x14, 0x23, 0x3e, 0x1c, 0x4c, 0xe6, 0x9e, 0xb8, 0xb7,
+    0x2d, 0xa8, 0xd0, 0xd5, 0x86, 0x3e, 0x95, 0x58, 0x81, 0xa8, 0xc8, 0x0d, 0x9d, 0x13, 0x6a, 0x61,
+    0xd9, 0xd6, 0x56, 0x4a, 0x6e, 0xed, 0xde, 0x9c, 0x18, 0xbd, 0xf6, 0x47, 0xb6, 0xe1, 0x2a, 0xe0,
+    0xa9, 0x46, 0x95, 0x54, 0xda, 0x25, 0xbe, 0x64, 0xca, 0xcf, 0x97, 0x1d, 0x5d, 0xba, 0x13, 0x36,
+    0x9b, 0xf6, 0x3c, 0xdc, 0x7b, 0xa1, 0xc4, 0xd2, 0x05, 0xbf, 0xc6, 0xe8, 0xb9, 0x90, 0x98, 0x44,
+    0x93, 0xa7, 0xd4, 0x8d, 0x13, 0x5a, 0xc1, 0x8a, 0xcb, 0x96, 0x54, 0x4c, 0xd9, 0x2c, 0x4f, 0xe1,
+    0x86, 0xaf, 0xb0, 0x82, 0xdc, 0xe8, 0x82, 0x17, 0x42, 0x92, 0x60, 0x68, 0xa7, 0xbd, 0x08, 0x7c,
+    0xe2, 0xd1, 0x67, 0x10, 0xc9, 0xb0, 0x9a, 0xe5, 0x7d, 0x78, 0x27, 0x25, 0xfc, 0x41, 0x59, 0xa3,
+    0x39, 0xed, 0x32, 0xa0, 0x20, 0x03, 0xf8, 0x84, 0x66, 0x49, 0xd5, 0x5c, 0x19, 0xfc, 0xd6, 0xa2,
+    0x2a, 0x37, 0x27, 0xe1, 0x43, 0x82, 0x0f, 0xe1, 0xcf, 0x76, 0x59, 0x10, 0x29, 0x5c, 0x2b, 0x79,
+    0x1a, 0x3a, 0x22, 0xe8, 0x08, 0xf2, 0x56, 0x95, 0xae, 0xe5, 0xfe, 0xe0, 0x24, 0x72, 0x4c, 0xc8,
+    0x71, 0x97, 0x29, 0xbc, 0x89, 0x3e, 0x27, 0xd1, 0x6f, 0x09, 0xfd, 0x16, 0xde, 0xe3, 0x42, 0x28,
+    0xea, 0x04, 0xe8, 0x9f, 0x04, 0x5e, 0x10, 0xf0, 0x62, 0x0f, 0x1c, 0x9c, 0x04, 0x52, 0xfb, 0xe6,
+    0x93, 0x3d, 0x70, 0x78, 0x12, 0x78, 0x49, 0xc0, 0xcb, 0x3d, 0x70, 0x74, 0x00, 0xec, 0x45, 0xe1,
+    0x69, 0x25, 0x54, 0xd3, 0x3a, 0x70, 0x9b, 0x86, 0x1c, 0x54, 0x10, 0x8a, 0xc5, 0xb6, 0x6a, 0x10,
+    0xab, 0x24, 0x9c, 0x32, 0x58, 0x0a, 0x45, 0xda, 0xa7, 0xb4, 0xe0, 0xf7, 0x7e, 0x41, 0xab, 0xee,
+    0x07, 0x19, 0xb3, 0x17, 0x48, 0xfc, 0xd8, 0x25, 0x4f, 0x99, 0x9e, 0x23, 0xa2, 0x55, 0x18, 0x92,
+    0x8c, 0x7d, 0x20, 0x27, 0x4e, 0x4d, 0x61, 0x20, 0x78, 0xc2, 0x2f, 0x57, 0xdc, 0x28, 0xbb, 0xa6,
+    0x6e, 0xad, 0x7f, 0x3d, 0x83, 0x14, 0x32, 0xd0, 0xf3, 0x38, 0x10, 0xd4, 0xee, 0x2f, 0x37, 0x7d,
+    0xd1, 0x3a, 0xa7, 0x63, 0xdb, 0x5b, 0xc7, 0x8d, 0x4b, 0x0a, 0x47, 0x57, 0xc3, 0x8d, 0x5f, 0x4e,
+    0x7b, 0xf1, 0xf0, 0x18, 0xa5, 0x9b, 0x00, 0x82, 0x4a, 0x58, 0x3f, 0xd4, 0x15, 0xa1, 0x75, 0x73,
+    0x00, 0xde, 0xcd, 0xd1, 0xba, 0x59, 0x26, 0x34, 0xf7, 0x28, 0xd9, 0x6c, 0x30, 0x86, 0xbf, 0xf3,
+    0x2f, 0xbb, 0xa1, 0xf9, 0x8f, 0xbc, 0xe2, 0x34, 0x09, 0x57, 0xd6, 0x5d, 0x9a, 0x81, 0x06, 0xe6,
+    0xda, 0x74, 0x76, 0x2b, 0x45, 0xe5, 0x35, 0xec, 0xdc, 0xc3, 0xb6, 0x8b, 0x96, 0x7b, 0xc8, 0xb4,
+    0x17, 0x76, 0x47, 0xda, 0x1b, 0xba, 0xfe, 0xf0, 0x30, 0x40, 0x47, 0x14, 0x64, 0x1f, 0xa6, 0x9d,
+    0xf0, 0xfd, 0x43, 0xe5, 0x27, 0x7e, 0x6d, 0x1d, 0x36, 0x64, 0x4f, 0x1f, 0x5d, 0x15, 0x91, 0x23,
+    0xc0, 0x8e, 0x73, 0x89, 0xc6, 0x19, 0xf9, 0xc2, 0xe7, 0x87, 0xef, 0xad, 0x7c, 0x57, 0xea, 0xb3,
+    0x75, 0xbd, 0x6f, 0x1f, 0x1e, 0xfc, 0x5d, 0xd9, 0x15, 0xf6, 0x08, 0xea, 0xf4, 0x62, 0x21, 0xf1,
+    0xb8, 0xd7, 0xca, 0x1a, 0xcb, 0xbb, 0x42, 0xdf, 0xc7, 0x92, 0x8b, 0x40, 0x90, 0x50, 0xef, 0x88,
+    0x95, 0x4f, 0xd8, 0x1f, 0x62, 0xd5, 0x15, 0xf4, 0x88, 0xa8, 0x13, 0x66, 0x7f, 0xd3, 0xed, 0xc2,
+    0xee, 0xaa, 0xdf, 0xd2, 0xc5, 0xec, 0x9e, 0x2f, 0xff, 0x5d, 0x08, 0xf5, 0xbf, 0x94, 0xdf, 0x75,
+    0x7f, 0x2e, 0xf9, 0x06, 0x5c, 0x8d, 0xb0, 0x0c, 0x2f, 0x88, 0x50, 0xb4, 0x11, 0x16, 0x0a, 0x22,
+    0xb0, 0x3e, 0xe1, 0x1b, 0xf2, 0xa1, 0x4e, 0xc4, 0x9f, 0xd0, 0xc9, 0x6e, 0x29, 0x12, 0xad, 0xd8,
+    0x0f, 0xab, 0xb3, 0x23, 0x79, 0x49, 0x9f, 0xeb, 0xf9, 0xfc, 0x58, 0x9c, 0x03, 0x8d, 0x3c, 0xcd,
+    0x5d, 0xe1, 0xa3, 0x44, 0xdb, 0x93, 0x27, 0xea, 0xc5, 0x97, 0xa9, 0x34, 0xa2, 0x71, 0x60, 0x4d,
+    0x99, 0x31, 0xde, 0x34, 0xe7, 0xff, 0xf8, 0x67, 0x73, 0x50, 0xce, 0x71, 0xc4, 0x2f, 0x70, 0x88,
+    0x93, 0xb4, 0x1a, 0xf5, 0x2f, 0x03, 0x3e, 0x00, 0x7d, 0xe4, 0xed, 0xc3, 0xd9, 0x8b, 0x7f, 0x18,
+    0xfe, 0x05, 0x8a, 0x77, 0xb2, 0x33, 0x41, 0x08, 0x00, 0x00,
+};
+
+static const Asset ASSETS[] = {
+    { "/style.css", "text/css", "\"05c5e50d8b4a328f\"", true, STYLE_CSS_GZ, sizeof(STYLE_CSS_GZ) },
+    { "/app.js", "application/javascript", "\"2cfe4a7e3e80d419\"", true, APP_JS_GZ, sizeof(APP_JS_GZ) },
+    { "/index.html", "text/html", "\"cc76f187ea3e8795\"", false, INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ) },
+};
+
+static const uint8_t ASSET_COUNT = sizeof(ASSETS) / sizeof(ASSETS[0]);
+
+} // namespace WebAssets
@@ -2,9 +2,22 @@
 
 #include <Arduino.h>
 #include "trainer.h"
+#include "storage.h"
 
 namespace WebServer {
-    void begin();
-    void update();  // call from loop() for cleanup
+    // Starts WiFi (STA per cfg, else AP) without waiting for it
+    void begin(const Storage::Config& cfg);
+
+    // Call from loop(): WiFi bring-up and AP fallback, event batches,
+    // client cleanup
+    void update();
     void onTrainerEvent(const TrainerEvent& evt);
+
+    // "connecting", "sta", "ap" (or "off" before begin())
+    const char* wifiState();
+    IPAddress ipAddress();
+
+    // Connected WebSocket clients and messages waiting in their send queues
+    uint8_t clientCount();
+    uint32_t queueDepth();
 }
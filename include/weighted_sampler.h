@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Weighted random index selection over N slots using a Fenwick (binary
+// indexed) tree. Changing one weight and drawing a sample are both
+// O(log N), so the character set can grow without slowing the trainer.
+// Draws match a linear cumulative scan: for a target t in [0, total()),
+// find(t) returns the first index whose running sum exceeds t.
+template <uint16_t N>
+class WeightedSampler {
+public:
+    static_assert(N > 0, "WeightedSampler needs at least one slot");
+
+    void clear() {
+        memset(_weight, 0, sizeof(_weight));
+        memset(_tree, 0, sizeof(_tree));
+        _total = 0;
+    }
+
+    // Load all weights at once, O(N)
+    void build(const uint8_t* weights) {
+        _total = 0;
+        for (uint16_t i = 0; i < N; i++) {
+            _weight[i] = weights[i];
+            _tree[i + 1] = weights[i];
+            _total += weights[i];
+        }
+        for (uint16_t i = 1; i <= N; i++) {
+            uint16_t parent = i + (i & -i);
+            if (parent <= N) _tree[parent] += _tree[i];
+        }
+    }
+
+    void set(uint16_t index, uint8_t weight) {
+        if (index >= N) return;
+        int32_t delta = (int32_t)weight - _weight[index];
+        _weight[index] = weight;
+        _total += delta;
+        for (uint16_t i = index + 1; i <= N; i += (i & -i)) {
+            _tree[i] += delta;
+        }
+    }
+
+    uint8_t weight(uint16_t index) const {
+        return index < N ? _weight[index] : 0;
+    }
+
+    // Sum of all weights
+    uint32_t total() const { return _total; }
+
+    // Index holding the target-th unit of weight, target < total()
+    uint16_t find(uint32_t target) const {
+        uint16_t pos = 0;
+        for (uint16_t step = topBit(); step; step >>= 1) {
+            uint16_t next = pos + step;
+            if (next <= N && _tree[next] <= target) {
+                pos = next;
+                target -= _tree[next];
+            }
+        }
+        return pos;
+    }
+
+    // Draw an index with probability weight / total(). Returns N if all
+    // weights are zero.
+    template <typename Rng>
+    uint16_t sample(Rng& rng) const {
+        if (_total == 0) return N;
+        return find(rng.below(_total));
+    }
+
+private:
+    uint8_t _weight[N];
+    uint32_t _tree[N + 1];   // 1-based Fenwick partial sums
+    uint32_t _total = 0;
+
+    static constexpr uint16_t topBit(uint16_t b = 1) {
+        return (b << 1) > N ? b : topBit(b << 1);
+    }
+};
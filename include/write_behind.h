@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Write-behind bookkeeping for a value kept in RAM and persisted later.
+// Changes mark fields dirty (one bit each); the owner writes everything
+// out once the value has been left alone for quietMs and the caller says
+// it's a good moment (nothing time-critical running). A burst of changes
+// costs one write, and setting a field to what it already holds costs
+// none (the owner doesn't mark it).
+class WriteBehind {
+public:
+    explicit WriteBehind(uint32_t quietMs) : _quietMs(quietMs) {}
+
+    void mark(uint32_t fields, uint32_t nowMs) {
+        _dirty |= fields;
+        _lastMs = nowMs;
+        _changes++;
+    }
+
+    uint32_t dirty() const { return _dirty; }
+
+    // Should the owner write now?
+    bool due(uint32_t nowMs, bool idle) const {
+        return _dirty && idle && nowMs - _lastMs >= _quietMs;
+    }
+
+    // Claim the dirty fields for a write; put them back with mark() if
+    // the write fails
+    uint32_t take() {
+        uint32_t d = _dirty;
+        _dirty = 0;
+        if (d) _writes++;
+        return d;
+    }
+
+    uint32_t changes() const { return _changes; }  // mark() calls
+    uint32_t writes() const { return _writes; }    // take()s that had work
+
+private:
+    uint32_t _quietMs;
+    uint32_t _dirty = 0;
+    uint32_t _lastMs = 0;
+    uint32_t _changes = 0;
+    uint32_t _writes = 0;
+};
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <Arduino.h>
+#include "trainer.h"
+
+// Binary WebSocket encoding of trainer events (protocol version 2).
+//
+// A client opts in by sending {"type":"hello","proto":"bin","version":2}
+// after connecting; the server answers with the protocol it will use for
+// that client ("bin" or "json") and clients that never say hello get
+// JSON. Commands and replies other than events stay JSON.
+//
+// Events are fixed-length records, sent as WS binary frames holding one
+// or more records back to back (the web server batches them). Byte 0 of
+// a record is the tag: event type in the low nibble, flags in the high
+// nibble; the type alone gives the record length. Multi-byte fields are
+// little endian; u24 fields are microseconds.
+//
+//   CHAR_SENT     0x01  ch, code.len, code.bits, queue_dist, duration u24   8 bytes
+//   RESULT        0x02  typed, expected, prob, latency u16, avg u16         8 bytes
+//                       flags: 0x10 correct, 0x20 latency measured
+//   SPEED_CHANGE  0x03  speed, dit u24                                      5 bytes
+//                       flags: direction 0x00 set, 0x10 up, 0x20 down
+//   SESSION       0x04  speed, char_speed, dit u24                          6 bytes
+//                       flags: 0x10 running
+//   CONTEXT_LOST  0x05  speed, dit u24                                      5 bytes
+//   CHAR_START    0x06  ch, code.len, code.bits, start u32, dit u24, gap u24  14 bytes
+//   SEQ           0x07  seq u32                                             5 bytes
+//
+// SEQ ends every frame that carries logged events: the sequence number
+// of the last of them (see "Resume" below). CHAR_START is live-only and
+// never logged or numbered. In JSON each logged event has a "seq" field.
+//
+// Latencies saturate at 65535 ms; speeds fit a byte (MAX_SPEED <= 255).
+// CHAR_START's start is the device's micros() (wraps every ~71 minutes);
+// {"type":"command","cmd":"clock","t":<client time>} is answered with
+// {"type":"clock","t":<echoed>,"us":<micros()>} so the client can map it
+// onto its own clock.
+//
+// Resume: the server numbers events as it broadcasts them and keeps the
+// last WS_EVENT_LOG_LENGTH. A reconnecting client adds "boot" and "seq"
+// (from its last hello answer and the last number it saw) to its hello;
+// the answer carries the server's boot id, its latest seq and "resume":
+//   "replay"    the missed events follow, then live events
+//   "live"      nothing was missed
+//   "snapshot"  a status message (with "seq") follows instead: the client
+//               is new, the device restarted or the log has moved on
+namespace WsProtocol {
+
+const uint8_t VERSION   = 2;
+const uint8_t MAX_FRAME = 14;
+const uint8_t SEQ_LEN   = 5;
+
+enum Tag : uint8_t {
+    TAG_CHAR_SENT    = 0x01,
+    TAG_RESULT       = 0x02,
+    TAG_SPEED_CHANGE = 0x03,
+    TAG_SESSION      = 0x04,
+    TAG_CONTEXT_LOST = 0x05,
+    TAG_CHAR_START   = 0x06,
+    TAG_SEQ          = 0x07
+};
+
+const uint8_t FLAG_CORRECT  = 0x10;  // RESULT
+const uint8_t FLAG_LATENCY  = 0x20;  // RESULT
+const uint8_t FLAG_RUNNING  = 0x10;  // SESSION
+const uint8_t FLAG_DIR_UP   = 0x10;  // SPEED_CHANGE
+const uint8_t FLAG_DIR_DOWN = 0x20;  // SPEED_CHANGE
+
+static_assert(MAX_SPEED <= 255, "speeds are sent as one byte");
+static_assert(DAH_UNITS == 3 && ELEMENT_GAP_UNITS == 1,
+              "CHAR_START sends only the dit; clients assume standard ratios");
+
+// Record length for a tag byte, 0 if the type is unknown
+inline uint8_t recordLen(uint8_t tag) {
+    static const uint8_t LEN[] = { 0, 8, 8, 5, 6, 5, 14, 5 };
+    uint8_t type = tag & 0x0F;
+    return type < sizeof(LEN) ? LEN[type] : 0;
+}
+
+inline uint8_t* put16(uint8_t* p, uint32_t v) {
+    if (v > 0xFFFF) v = 0xFFFF;
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+inline uint8_t* put24(uint8_t* p, uint32_t v) {
+    if (v > 0xFFFFFF) v = 0xFFFFFF;
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    return p + 3;
+}
+
+inline uint8_t* put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+    return p + 4;
+}
+
+// Encode one event into out (MAX_FRAME bytes). Returns the frame length.
+inline uint8_t encode(const TrainerEvent& evt, uint8_t* out) {
+    uint8_t* p = out + 1;
+    switch (evt.type) {
+        case TrainerEvent::CHAR_SENT:
+            out[0] = TAG_CHAR_SENT;
+            *p++ = (uint8_t)evt.sent.ch;
+            *p++ = evt.sent.code.len;
+            *p++ = evt.sent.code.bits;
+            *p++ = evt.sent.queueDist;
+            p = put24(p, evt.sent.durationUs);
+            break;
+
+        case TrainerEvent::RESULT:
+            out[0] = TAG_RESULT;
+            if (evt.result.correct) out[0] |= FLAG_CORRECT;
+            if (evt.result.latencyMs >= 0) out[0] |= FLAG_LATENCY;
+            *p++ = (uint8_t)evt.result.typed;
+            *p++ = (uint8_t)evt.result.expected;
+            *p++ = evt.result.prob;
+            p = put16(p, evt.result.latencyMs >= 0 ? (uint32_t)evt.result.latencyMs : 0);
+            p = put16(p, evt.result.latencyAvgMs);
+            break;
+
+        case TrainerEvent::SPEED_CHANGE:
+            out[0] = TAG_SPEED_CHANGE;
+            if (evt.state.direction && strcmp(evt.state.direction, "up") == 0) {
+                out[0] |= FLAG_DIR_UP;
+            } else if (evt.state.direction && strcmp(evt.state.direction, "down") == 0) {
+                out[0] |= FLAG_DIR_DOWN;
+            }
+            *p++ = (uint8_t)evt.state.speed;
+            p = put24(p, evt.state.ditUs);
+            break;
+
+        case TrainerEvent::SESSION_STATE:
+            out[0] = TAG_SESSION;
+            if (evt.state.running) out[0] |= FLAG_RUNNING;
+            *p++ = (uint8_t)evt.state.speed;
+            *p++ = (uint8_t)evt.state.charSpeed;
+            p = put24(p, evt.state.ditUs);
+            break;
+
+        case TrainerEvent::CONTEXT_LOST:
+            out[0] = TAG_CONTEXT_LOST;
+            *p++ = (uint8_t)evt.state.speed;
+            p = put24(p, evt.state.ditUs);
+            break;
+
+        case TrainerEvent::CHAR_START:
+            out[0] = TAG_CHAR_START;
+            *p++ = (uint8_t)evt.tone.ch;
+            *p++ = evt.tone.code.len;
+            *p++ = evt.tone.code.bits;
+            p = put32(p, evt.tone.startUs);
+            p = put24(p, evt.tone.ditUs);
+            p = put24(p, evt.tone.gapUs);
+            break;
+
+        default:
+            return 0;
+    }
+    return (uint8_t)(p - out);
+}
+
+// SEQ record closing a frame of logged events. Returns SEQ_LEN.
+inline uint8_t encodeSeq(uint32_t seq, uint8_t* out) {
+    out[0] = TAG_SEQ;
+    put32(out + 1, seq);
+    return SEQ_LEN;
+}
+
+} // namespace WsProtocol
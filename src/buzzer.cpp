@@ -1,9 +1,10 @@
 #include "buzzer.h"
 #include "config.h"
 
-static bool _on = false;
+static volatile bool _on = false;
 static int _freq = TONE_FREQ;
-static bool _active = BUZZER_ACTIVE_DEFAULT;
+static volatile bool _active = BUZZER_ACTIVE_DEFAULT;
+static volatile uint32_t _halfPeriodCcy = microsecondsToClockCycles(500000UL / TONE_FREQ);
 
 void Buzzer::begin() {
     pinMode(BUZZER_PIN, OUTPUT);
@@ -39,6 +40,7 @@ bool Buzzer::isOn() {
 
 void Buzzer::setFrequency(int hz) {
     _freq = hz;
+    _halfPeriodCcy = microsecondsToClockCycles(500000UL / (uint32_t)hz);
     if (_on && !_active) {
         tone(BUZZER_PIN, _freq);
     }
@@ -55,6 +57,25 @@ void Buzzer::setActive(bool active) {
     if (wasOn) toneOn();
 }
 
-bool Buzzer::isActive() {
+bool IRAM_ATTR Buzzer::isActive() {
     return _active;
 }
+
+void IRAM_ATTR Buzzer::isrToneOn() {
+    GPOS = (1 << BUZZER_PIN);
+    _on = true;
+}
+
+void IRAM_ATTR Buzzer::isrToneOff() {
+    GPOC = (1 << BUZZER_PIN);
+    _on = false;
+}
+
+void IRAM_ATTR Buzzer::isrToggle() {
+    if (GPO & (1 << BUZZER_PIN)) GPOC = (1 << BUZZER_PIN);
+    else GPOS = (1 << BUZZER_PIN);
+}
+
+uint32_t IRAM_ATTR Buzzer::halfPeriodCycles() {
+    return _halfPeriodCcy;
+}
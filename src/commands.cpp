@@ -0,0 +1,109 @@
+#include "commands.h"
+#include "trainer.h"
+#include "morse_engine.h"
+#include "buzzer.h"
+#include "storage.h"
+#include "serial_interface.h"
+
+Command::Result Command::run(Id id, const CommandArgs& args) {
+    int n;
+    bool on;
+    switch (id) {
+        case START: {
+            int profile = DEFAULT_PROFILE;
+            int speed = DEFAULT_SPEED;
+            int charSpeed = -1;  // keep current
+            args.getInt("profile", profile);
+            args.getInt("speed", speed);
+            args.getInt("char_speed", charSpeed);
+            trainer.start(constrain(profile, 0, NUM_PROFILES - 1),
+                          constrain(speed, MIN_SPEED, MAX_SPEED), charSpeed);
+            return DONE;
+        }
+
+        case STOP:
+            trainer.stop();
+            return DONE;
+
+        case SPEED:
+            if (!args.has("speed")) return SHOW;
+            if (!args.getInt("speed", n) || n < MIN_SPEED || n > MAX_SPEED) return INVALID;
+            trainer.setSpeed(n);
+            return DONE;
+
+        case PROFILE:
+            if (!args.has("profile")) return SHOW;
+            if (!args.getInt("profile", n) || n < 0 || n >= NUM_PROFILES) return INVALID;
+            trainer.setProfile(n);
+            return DONE;
+
+        case PITCH:
+            if (!args.has("freq")) return SHOW;
+            if (!args.getInt("freq", n) || n < MIN_TONE_FREQ || n > MAX_TONE_FREQ) return INVALID;
+            Buzzer::setFrequency(n);
+            return DONE;
+
+        case BUZZER_TYPE:
+            if (!args.has("active")) return SHOW;
+            if (!args.getBool("active", on)) return INVALID;
+            Buzzer::setActive(on);
+            Storage::setBuzzerActive(on);
+            return DONE;
+
+        case DRILL:
+            if (!args.has("on")) return SHOW;
+            if (!args.getBool("on", on)) return INVALID;
+            trainer.setDrill(on);
+            return DONE;
+
+        case LAG:
+            if (!args.has("limit")) return SHOW;
+            if (!args.getInt("limit", n)) return INVALID;
+            trainer.setLagLimit(n);
+            Storage::setLagLimit(trainer.getLagLimit());
+            return DONE;
+
+        case LOG: {
+            const char* v = args.getStr("level");
+            if (!v) return SHOW;
+            for (uint8_t i = SerialInterface::QUIET; i <= SerialInterface::FULL; i++) {
+                auto level = (SerialInterface::Verbosity)i;
+                bool digit = v[0] == '0' + i && !v[1];
+                if (digit || strcmp(v, SerialInterface::verbosityName(level)) == 0) {
+                    SerialInterface::setVerbosity(level);
+                    return DONE;
+                }
+            }
+            return INVALID;
+        }
+
+        case EVENTS:
+            if (!args.getBool("reset", on) || !on) return SHOW;
+            eventBus.resetStats();
+            return DONE;
+
+        case TIMING:
+            if (!args.getBool("reset", on) || !on) return SHOW;
+            MorseEngine::resetEdgeTiming();
+            return DONE;
+
+        case CONFUSION:
+            if (!args.getBool("reset", on) || !on) return SHOW;
+            trainer.resetConfusion();
+            return DONE;
+
+        case WIFI: {
+            if (!args.has("mode")) return SHOW;
+            const char* ssid = args.getStr("ssid");
+            const char* pass = args.getStr("pass");
+            if (!ssid || !Storage::setWifi(args.getStr("mode"), ssid, pass ? pass : "")) {
+                return INVALID;
+            }
+            Storage::flushConfig();  // a reset usually follows straight away
+            return DONE;
+        }
+
+        default:
+            return SHOW;  // reports: the transport formats them
+    }
+}
@@ -0,0 +1,244 @@
+#include "journal.h"
+#include "trainer.h"
+#include "write_behind.h"
+#include <LittleFS.h>
+
+#define JOURNAL_TOTALS_TMP "/journal_totals.tmp"
+
+// Records not yet on flash
+static uint8_t buf[JOURNAL_BUFFER_BYTES];
+static uint16_t bufLen = 0;
+static WriteBehind bufWriter(JOURNAL_FLUSH_DELAY_MS);
+
+static uint32_t fileBytes = 0;        // on flash, buffer not included
+static bool compactDue = false;
+static bool compactFailed = false;    // back off before trying again
+static uint32_t compactFailedMs = 0;
+static uint8_t exportsOpen = 0;       // compaction waits for these
+static uint32_t generation = 0;       // compactions so far
+
+// Where the event stream has got to
+static bool sessionStart = false;
+static uint32_t lastMs = 0;
+static uint8_t speed = 0;
+
+static Journal::Stats st;
+
+// Scratch for compaction and totals (too big for the async handler's stack)
+static Journal::CharTotals totals[CHAR_COUNT];
+static uint8_t chunk[JOURNAL_BUFFER_BYTES];
+
+static bool writeBuffer() {
+    if (bufLen == 0) return true;
+    uint32_t startUs = micros();
+    File f = LittleFS.open(JOURNAL_FILE, "a");
+    bool ok = f && f.write(buf, bufLen) == bufLen;
+    if (f) f.close();
+    st.lastWriteUs = micros() - startUs;
+    bufWriter.take();
+    if (!ok) {
+        // Leave the file as it was counted; these records are lost
+        st.dropped += bufLen / Journal::RECORD_LEN;
+        bufLen = 0;
+        return false;
+    }
+    fileBytes += bufLen;
+    bufLen = 0;
+    st.pageWrites++;
+    if (fileBytes >= JOURNAL_MAX_BYTES) compactDue = true;
+    return true;
+}
+
+// Fold the journal into the totals file and start it afresh. The new
+// totals replace the old by rename, so a reset part way leaves either
+// the old totals and the journal, or (between rename and remove) the
+// journal counted twice - never a loss. False if a step failed; the
+// journal is then left as it was.
+static bool compact() {
+    uint32_t startUs = micros();
+    memset(totals, 0, sizeof(totals));
+    File t = LittleFS.open(JOURNAL_TOTALS_FILE, "r");
+    if (t) {
+        if (t.size() == sizeof(totals)) t.read((uint8_t*)totals, sizeof(totals));
+        t.close();
+    }
+
+    File f = LittleFS.open(JOURNAL_FILE, "r");
+    if (f) {
+        size_t n;
+        while ((n = f.read(chunk, sizeof(chunk))) >= Journal::RECORD_LEN) {
+            for (size_t i = 0; i + Journal::RECORD_LEN <= n; i += Journal::RECORD_LEN) {
+                Journal::fold(totals, Journal::decode(chunk + i));
+            }
+        }
+        f.close();
+    }
+
+    File out = LittleFS.open(JOURNAL_TOTALS_TMP, "w");
+    if (!out) return false;
+    bool ok = out.write((const uint8_t*)totals, sizeof(totals)) == sizeof(totals);
+    out.close();
+    if (!ok || !LittleFS.rename(JOURNAL_TOTALS_TMP, JOURNAL_TOTALS_FILE)) return false;
+    LittleFS.remove(JOURNAL_FILE);
+
+    fileBytes = 0;
+    compactDue = false;
+    generation++;
+    st.compactions++;
+    st.lastCompactUs = micros() - startUs;
+    return true;
+}
+
+void Journal::begin() {
+    File f = LittleFS.open(JOURNAL_FILE, "r+");
+    if (f) {
+        // Cut off a torn last record, should power have failed mid-write
+        fileBytes = f.size() - f.size() % RECORD_LEN;
+        if (fileBytes != f.size()) f.truncate(fileBytes);
+        f.close();
+    }
+    compactDue = fileBytes >= JOURNAL_MAX_BYTES;
+}
+
+void Journal::onTrainerEvent(const TrainerEvent& evt) {
+    uint32_t now = millis();
+    switch (evt.type) {
+        case TrainerEvent::SESSION_STATE:
+            speed = (uint8_t)evt.state.speed;
+            if (evt.state.running) {
+                sessionStart = true;
+                lastMs = now;
+            }
+            return;
+        case TrainerEvent::SPEED_CHANGE:
+            speed = (uint8_t)evt.state.speed;
+            return;
+        case TrainerEvent::RESULT:
+            break;
+        default:
+            return;
+    }
+
+    if (fileBytes >= 2UL * JOURNAL_MAX_BYTES) {
+        st.dropped++;   // compaction is overdue and still waiting for idle
+        return;
+    }
+    if ((size_t)(bufLen + RECORD_LEN) > sizeof(buf)) writeBuffer();  // update() fell behind
+
+    Record r;
+    r.flags = 0;
+    if (evt.result.correct) r.flags |= FLAG_CORRECT;
+    if (evt.result.latencyMs >= 0) r.flags |= FLAG_LATENCY;
+    if (sessionStart) r.flags |= FLAG_SESSION;
+    r.expected = evt.result.expected;
+    r.typed = evt.result.typed;
+    r.speed = speed;
+    r.dtMs = sat16(now - lastMs);
+    r.latencyMs = evt.result.latencyMs >= 0 ? sat16((uint32_t)evt.result.latencyMs) : 0;
+    encode(r, buf + bufLen);
+    bufLen += RECORD_LEN;
+    bufWriter.mark(1, now);
+    sessionStart = false;
+    lastMs = now;
+    st.records++;
+}
+
+void Journal::update(bool idle) {
+    if (bufLen >= sizeof(buf) || bufWriter.due(millis(), idle)) writeBuffer();
+    if (compactDue && idle && exportsOpen == 0 &&
+        (!compactFailed || millis() - compactFailedMs >= JOURNAL_COMPACT_RETRY_MS)) {
+        writeBuffer();
+        compactFailed = !compact();
+        if (compactFailed) {
+            // Flash full or worn: don't re-read the whole journal every idle pass
+            compactFailedMs = millis();
+            st.compactFailures++;
+        }
+    }
+}
+
+Journal::Export::Export() : _generation(generation) {
+    exportsOpen++;
+}
+
+Journal::Export::~Export() {
+    exportsOpen--;
+}
+
+size_t Journal::Export::read(uint8_t* out, size_t len) {
+    size_t n = 0;
+    if (!_header) {
+        if (len < sizeof(CSV_HEADER)) return 0;
+        memcpy(out, CSV_HEADER, sizeof(CSV_HEADER) - 1);
+        n = sizeof(CSV_HEADER) - 1;
+        _header = true;
+    }
+    if (_generation != generation) return n;  // compacted under us (shouldn't happen)
+
+    // Flushed records first, then those still buffered. A flush between
+    // calls moves bytes from buf to the file; _pos stays valid across it.
+    uint8_t rec[RECORD_LEN];
+    char line[CSV_LINE_MAX];
+    File f;
+    while (_pos < fileBytes + bufLen) {
+        if (_pos < fileBytes) {
+            if (!f) {
+                f = LittleFS.open(JOURNAL_FILE, "r");
+                if (!f || !f.seek(_pos)) break;
+            }
+            if (f.read(rec, RECORD_LEN) != RECORD_LEN) break;
+        } else {
+            memcpy(rec, buf + (_pos - fileBytes), RECORD_LEN);
+        }
+        CsvWriter csv = _csv;
+        int l = csv.line(decode(rec), line, sizeof(line));
+        if (l == 0 || n + l > len) break;  // next call
+        _csv = csv;
+        memcpy(out + n, line, l);
+        n += l;
+        _pos += RECORD_LEN;
+    }
+    if (f) f.close();
+    return n;
+}
+
+void Journal::writeTotalsCsv(Print& out) {
+    memset(totals, 0, sizeof(totals));
+    File t = LittleFS.open(JOURNAL_TOTALS_FILE, "r");
+    if (t) {
+        if (t.size() == sizeof(totals)) t.read((uint8_t*)totals, sizeof(totals));
+        t.close();
+    }
+    File f = LittleFS.open(JOURNAL_FILE, "r");
+    if (f) {
+        uint32_t left = fileBytes;
+        size_t n;
+        while (left >= RECORD_LEN &&
+               (n = f.read(chunk, left < sizeof(chunk) ? left : sizeof(chunk))) >= RECORD_LEN) {
+            for (size_t i = 0; i + RECORD_LEN <= n; i += RECORD_LEN) {
+                fold(totals, decode(chunk + i));
+            }
+            left -= n;
+        }
+        f.close();
+    }
+    for (uint16_t i = 0; i < bufLen; i += RECORD_LEN) fold(totals, decode(buf + i));
+
+    out.print(TOTALS_CSV_HEADER);
+    char line[CSV_LINE_MAX];
+    char c[5];
+    for (uint8_t i = 0; i < CHAR_COUNT; i++) {
+        const CharTotals& ct = totals[i];
+        if (ct.attempts == 0) continue;
+        snprintf(line, sizeof(line), "%s,%lu,%lu,%lu\n", csvChar((char)(FIRST_CHAR + i), c),
+                 (unsigned long)ct.attempts, (unsigned long)ct.correct,
+                 (unsigned long)(ct.latencyCount ? ct.latencySumMs / ct.latencyCount : 0));
+        out.print(line);
+    }
+}
+
+Journal::Stats Journal::stats() {
+    Stats s = st;
+    s.fileBytes = fileBytes + bufLen;
+    return s;
+}
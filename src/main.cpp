@@ -8,12 +8,118 @@
 #include "web_server.h"
 #include "oled_display.h"
 #include "morse_key.h"
+#include "boot_timer.h"
+#include "metrics.h"
+#include "journal.h"
 
-// Unified event handler — broadcasts to serial, web, and OLED
+// Runtime metrics (served at /metrics and by the /metrics command)
+MetricsRegistry metrics;
+static Metrics::Counter eventsTotal;
+static Metrics::Rate eventsRate;
+
+// loop() time per subsystem and in total, in microseconds
+enum LoopStage : uint8_t { LOOP_ENGINE, LOOP_SERIAL, LOOP_KEY, LOOP_TRAINER,
+                           LOOP_EVENTS, LOOP_WEB, LOOP_OLED, LOOP_STORAGE, LOOP_STAGES };
+static const char* const LOOP_STAGE_LABELS[LOOP_STAGES] = {
+    "stage=\"engine\"", "stage=\"serial\"", "stage=\"key\"", "stage=\"trainer\"",
+    "stage=\"events\"", "stage=\"web\"", "stage=\"oled\"", "stage=\"storage\""
+};
+static LogHistogram loopStageUs[LOOP_STAGES];
+static LogHistogram loopUs;
+
+// Record the time since startUs against a stage; returns now
+static uint32_t lap(LoopStage stage, uint32_t startUs) {
+    uint32_t now = micros();
+    loopStageUs[stage].record(now - startUs);
+    return now;
+}
+
+// Per-sink event bus readings, one function per sink index
+template<uint8_t I> static int32_t sinkDepth() { return eventBus.stats(I).depth; }
+template<uint8_t I> static int32_t sinkDropped() { return (int32_t)eventBus.stats(I).dropped; }
+
+static void registerMetrics() {
+    for (uint8_t i = 0; i < LOOP_STAGES; i++) {
+        metrics.histogram("morse_loop_stage_us", "loop() time per subsystem (us)",
+                          &loopStageUs[i], LOOP_STAGE_LABELS[i]);
+    }
+    metrics.histogram("morse_loop_us", "Whole loop() pass (us)", &loopUs);
+
+    metrics.gauge("morse_heap_free_bytes", "Free heap",
+                  []() -> int32_t { return ESP.getFreeHeap(); });
+    metrics.gauge("morse_heap_max_block_bytes", "Largest allocatable heap block",
+                  []() -> int32_t { return ESP.getMaxFreeBlockSize(); });
+    metrics.gauge("morse_heap_fragmentation_percent", "Heap fragmentation",
+                  []() -> int32_t { return ESP.getHeapFragmentation(); });
+
+    // Sinks in the order setup() adds them
+    struct SinkMetrics { const char* labels; Metrics::ReadFn depth; Metrics::ReadFn dropped; };
+    static const SinkMetrics SINKS[] = {
+        { "sink=\"serial\"", sinkDepth<0>, sinkDropped<0> },
+        { "sink=\"web\"",    sinkDepth<1>, sinkDropped<1> },
+        { "sink=\"oled\"",   sinkDepth<2>, sinkDropped<2> },
+        { "sink=\"journal\"", sinkDepth<3>, sinkDropped<3> },
+    };
+    for (const SinkMetrics& s : SINKS) {
+        metrics.gauge("morse_event_queue_depth", "Events waiting per output", s.depth, s.labels);
+    }
+    for (const SinkMetrics& s : SINKS) {
+        metrics.counter("morse_event_dropped_total", "Events lost to a full output queue",
+                        s.dropped, s.labels);
+    }
+    metrics.counter("morse_serial_log_lines_total", "Lines queued for the serial port",
+                    []() -> int32_t { return (int32_t)SerialInterface::logStats().lines; });
+    metrics.counter("morse_serial_log_dropped_total", "Serial lines lost to a full log buffer",
+                    []() -> int32_t { return (int32_t)SerialInterface::logStats().dropped; });
+    metrics.gauge("morse_serial_log_queued_bytes", "Serial output waiting for the UART",
+                  []() -> int32_t { return SerialInterface::logStats().queued; });
+    metrics.counter("morse_events_total", "Trainer events published", &eventsTotal);
+    metrics.gauge("morse_events_per_second", "Trainer events in the last second",
+                  []() -> int32_t { return eventsRate.value(); });
+
+    metrics.gauge("morse_tx_queue_depth", "Characters waiting in the transmit queue",
+                  []() -> int32_t { return MorseEngine::queueDepth(); });
+    metrics.histogram("morse_tx_edge_late_ns", "Tone edge lateness against ideal time (ns)",
+                      &MorseEngine::edgeTiming());
+
+    metrics.gauge("morse_ws_clients", "Connected WebSocket clients",
+                  []() -> int32_t { return WebServer::clientCount(); });
+    metrics.gauge("morse_ws_queue_depth", "Messages waiting in WebSocket send queues",
+                  []() -> int32_t { return (int32_t)WebServer::queueDepth(); });
+
+    metrics.counter("morse_config_writes_total", "Config file writes",
+                    []() -> int32_t { return (int32_t)Storage::configStats().flushes; });
+    metrics.gauge("morse_config_dirty", "Config fields changed but not yet written (bits)",
+                  []() -> int32_t { return Storage::configStats().dirty; });
+    metrics.histogram("morse_config_write_us", "Config file write stall (us)",
+                      &Storage::configFlushTiming());
+    metrics.counter("morse_probs_writes_total", "Probability store writes",
+                    []() -> int32_t { return (int32_t)Storage::probsStats().flushes; });
+    metrics.histogram("morse_probs_write_us", "Probability store write stall (us)",
+                      &Storage::probsFlushTiming());
+    metrics.counter("morse_confusion_writes_total", "Confusion matrix writes",
+                    []() -> int32_t { return (int32_t)Storage::confusionStats().flushes; });
+    metrics.histogram("morse_confusion_write_us", "Confusion matrix write stall (us)",
+                      &Storage::confusionFlushTiming());
+
+    metrics.counter("morse_journal_records_total", "Results appended to the session journal",
+                    []() -> int32_t { return (int32_t)Journal::stats().records; });
+    metrics.counter("morse_journal_page_writes_total", "Journal buffer flushes to flash",
+                    []() -> int32_t { return (int32_t)Journal::stats().pageWrites; });
+    metrics.counter("morse_journal_compact_failures_total", "Journal compactions that failed",
+                    []() -> int32_t { return (int32_t)Journal::stats().compactFailures; });
+    metrics.gauge("morse_journal_bytes", "Session journal size",
+                  []() -> int32_t { return (int32_t)Journal::stats().fileBytes; });
+
+    metrics.gauge("morse_uptime_seconds", "Time since boot",
+                  []() -> int32_t { return (int32_t)(millis() / 1000); });
+}
+
+// Unified event handler — queues for serial, web, and OLED (delivered
+// from loop() so a slow sink never stalls the trainer)
 static void onTrainerEvent(const TrainerEvent& evt) {
-    SerialInterface::onTrainerEvent(evt);
-    WebServer::onTrainerEvent(evt);
-    OledDisplay::onTrainerEvent(evt);
+    eventsTotal.inc();
+    eventBus.publish(evt);
 }
 
 // Morse element callback — updates OLED keying indicator
@@ -21,54 +127,105 @@ static void onMorseElement(bool on) {
     OledDisplay::onMorseElement(on);
 }
 
+// Morse char-done callback — advances the trainer's send accounting
+static void onMorseCharDone(char ch, uint32_t doneUs) {
+    trainer.onCharDone(ch, doneUs);
+}
+
+// Morse char-start callback — element timelines for remote sidetone
+static void onMorseCharStart(const MorseCharStart& start) {
+    trainer.onCharStart(start);
+}
+
+BootTimer bootTimer;
+
+// Boot path: everything the serial trainer, key and buzzer need, in
+// order, each phase timed. WiFi only starts here and comes up from
+// loop(), so training is possible long before the web UI is.
 void setup() {
+    bootTimer.mark("core", micros());
+
     // Status LED
     pinMode(STATUS_LED_PIN, OUTPUT);
     digitalWrite(STATUS_LED_PIN, LOW); // on (active low on ESP8266)
 
     // Serial
     SerialInterface::begin();
+    bootTimer.mark("serial", micros());
 
     // Storage
     if (!Storage::begin()) {
         Serial.println(F("LittleFS mount failed!"));
     }
+    bootTimer.mark("storage", micros());
+
+    // Learned probabilities (one read per A/B slot)
+    Storage::restoreProbs();
+    bootTimer.mark("probs", micros());
 
     // Load config and apply buzzer type
-    {
-        Storage::Config cfg;
-        Storage::loadConfig(cfg);
-        Buzzer::setActive(cfg.buzzerActive);
-    }
+    Storage::loadConfig();
+    const Storage::Config& cfg = Storage::config();
+    Buzzer::setActive(cfg.buzzerActive);
+    Journal::begin();
+    bootTimer.mark("config", micros());
 
     // Morse engine
     MorseEngine::begin();
     MorseEngine::onElement(onMorseElement);
+    MorseEngine::onCharDone(onMorseCharDone);
+    MorseEngine::onCharStart(onMorseCharStart);
+    bootTimer.mark("engine", micros());
 
     // Trainer
     trainer.begin();
     trainer.onEvent(onTrainerEvent);
+    eventBus.addSink("serial", SerialInterface::onTrainerEvent, TrainerEventBus::DROP_OLDEST,
+                     SERIAL_EVENT_BUDGET);
+    eventBus.addSink("web", WebServer::onTrainerEvent, TrainerEventBus::DROP_OLDEST,
+                     WEB_EVENT_BUDGET);
+    eventBus.addSink("oled", OledDisplay::onTrainerEvent, TrainerEventBus::COALESCE);
+    eventBus.addSink("journal", Journal::onTrainerEvent, TrainerEventBus::DROP_OLDEST);
+    trainer.setCharSpeed(cfg.charSpeed);
+    trainer.setLagLimit(cfg.lagLimit);
+    registerMetrics();
 
-    // Web server (WiFi + HTTP + WebSocket)
-    WebServer::begin();
-
-    // OLED display
-    OledDisplay::begin();
+    // Random seed
+    trainer.seed(analogRead(A0) ^ micros());
+    bootTimer.mark("trainer", micros());
 
     // Morse key input
     MorseKey::begin();
+    bootTimer.mark("key", micros());
 
-    // Random seed
-    randomSeed(analogRead(A0) ^ micros());
+    // OLED display
+    OledDisplay::begin();
+    bootTimer.mark("oled", micros());
+
+    // Web server (WiFi + HTTP + WebSocket); WiFi finishes from loop()
+    WebServer::begin(cfg);
+    bootTimer.mark("web", micros());
 
     digitalWrite(STATUS_LED_PIN, HIGH); // off (ready)
+    SerialInterface::printBootReport();
     Serial.println(F("Ready. Type /help for commands."));
 }
 
 void loop() {
-    SerialInterface::update();
-    MorseKey::update();
-    trainer.update();
-    WebServer::update();
-    OledDisplay::update();
+    uint32_t startUs = micros();
+    uint32_t t = startUs;
+    MorseEngine::update();     t = lap(LOOP_ENGINE, t);
+    SerialInterface::update(); t = lap(LOOP_SERIAL, t);
+    MorseKey::update();        t = lap(LOOP_KEY, t);
+    trainer.update();          t = lap(LOOP_TRAINER, t);
+    eventBus.drain();          t = lap(LOOP_EVENTS, t);
+    WebServer::update();       t = lap(LOOP_WEB, t);
+    OledDisplay::update();     t = lap(LOOP_OLED, t);
+    bool idle = !MorseEngine::isSending();
+    Storage::updateConfig(idle);
+    Storage::updateLearned(idle);
+    Journal::update(idle);
+    t = lap(LOOP_STORAGE, t);
+    loopUs.record(t - startUs);
+    eventsRate.update(millis(), eventsTotal.value());
 }
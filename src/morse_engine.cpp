@@ -1,52 +1,107 @@
 #include "morse_engine.h"
-#include "morse_table.h"
 #include "config.h"
 #include "buzzer.h"
+#include "ring_buffer.h"
 
-// --- FSM states ---
-enum MorseFsmState {
-    FSM_CHECK_OUTPUT = 1,
-    FSM_OUTPUT_LOW,
-    FSM_OUTPUT_HIGH,
-    FSM_FIRST_ON,
-    FSM_CHAR_GAP,
-    FSM_WORD_GAP,
-    FSM_NEXT_ON,
-    FSM_DASH_TIMING,
-    FSM_DOT_DONE,
-    FSM_CHAR_GAP_WAIT,
-    FSM_CHAR_DONE,
-    FSM_WORD_GAP_WAIT,
-    FSM_WORD_DONE,
-    FSM_DASH_DONE,
-    FSM_DASH_TICK,
+#include <core_esp8266_waveform.h>
+
+// --- Transmit queue (single producer: loop, single consumer: timer ISR) ---
+// Characters are encoded when queued so the ISR only does bit operations.
+// RingBuffer publishes each slot only after it is fully written, and only
+// the ISR advances the tail.
+#define TX_QUEUE_SIZE    8   // power of two
+#define DONE_QUEUE_SIZE  8   // power of two
+
+static_assert(TX_QUEUE_SIZE >= TX_LOOKAHEAD, "transmit queue must hold the trainer's lookahead");
+
+struct TxItem {
+    char ch;
+    uint8_t len;    // MorseCode elements (0 = word space)
+    uint8_t bits;   // MorseCode element bits
+    uint8_t epoch;  // flush() generation the item was queued in
+};
+
+struct DoneItem {
+    char ch;
+    uint8_t epoch;
+    uint32_t doneUs;  // micros() when the trailing gap ended
 };
 
+// Character started (single producer: ISR, single consumer: loop). Times
+// are captured raw and converted to microseconds in update().
+struct StartItem {
+    char ch;
+    uint8_t len;
+    uint8_t bits;
+    uint32_t nowUs;     // micros() when the character was loaded
+    uint32_t lateCcy;   // cycles since its ideal first edge
+    uint32_t ditQ;      // durations in effect, Q8 us
+    uint32_t gapQ;
+};
+
+static RingBuffer<TxItem, TX_QUEUE_SIZE> txQueue;
+
+// Completed characters (single producer: ISR, single consumer: loop)
+static RingBuffer<DoneItem, DONE_QUEUE_SIZE> doneQueue;
+static RingBuffer<StartItem, DONE_QUEUE_SIZE> startQueue;
+
+static volatile uint8_t epoch = 0;
+
+// Edge lateness samples in CPU cycles (single producer: ISR, consumer: loop)
+#define EDGE_SAMPLE_SIZE  32  // power of two
+
+static RingBuffer<uint32_t, EDGE_SAMPLE_SIZE> edgeSamples;
+static volatile uint32_t edgeDropped = 0;
+static LogHistogram edgeHist;
+
+// --- Element timeline ---
+// Each character is compiled into a list of segment durations before it
+// starts. Segment i is tone-on if bit i of timelineOnMask is set. A timer1
+// callback applies one edge per segment, so nothing runs between edges.
+#define TIMELINE_MAX  (2 * MORSE_MAX_ELEMENTS)
+
+static volatile uint32_t timelineUs[TIMELINE_MAX];
+static volatile uint16_t timelineOnMask = 0;
+static volatile uint8_t timelineLen = 0;
+static volatile uint8_t timelinePos = 0;
+static volatile uint32_t nextEdgeCcy = 0;   // ideal cycle count of next edge
+static volatile uint32_t nextToggleCcy = 0; // passive buzzer half-period edge
+static volatile bool toneIsOn = false;
+
 // --- State ---
-static volatile char morseSignalString[7];
-static volatile bool sendingMorse = false;
-static volatile int tick;
-static volatile bool stepped = false;
-static volatile MorseFsmState fsmState;
-static volatile int morseSignals;
-static volatile int morseSignalPos;
+static volatile bool sendingMorse = false;  // sending; cleared by the ISR when the queue runs dry
+static bool timerArmed = false;             // callback installed (loop side only)
+static volatile bool charActive = false;    // a character is on its timeline
 static volatile int currentSpeed = DEFAULT_SPEED;
+static volatile int effectiveSpeed = DEFAULT_SPEED;
+// Written by loop with interrupts off, read by the ISR per character
+static MorseTiming::Timing timing = MorseTiming::compute(DEFAULT_SPEED);
+static MorseTiming::Cursor timelineCursor;  // ISR only
 
 static MorseElementCB elementCB = nullptr;
 static MorseCharDoneCB charDoneCB = nullptr;
+static MorseCharStartCB charStartCB = nullptr;
 static volatile char currentChar = 0;
+static volatile uint8_t currentEpoch = 0;
+
+static bool reportedToneOn = false;
 
-static Ticker morseTicker;
+static uint32_t IRAM_ATTR onTimer1();
 
-// Forward declaration
-static void transmitMorse();
+// Callback interval from the queue draining until update() removes it
+#define ISR_IDLE_CCY microsecondsToClockCycles(1000)
 
 void MorseEngine::begin() {
     pinMode(MORSE_LED_PIN, OUTPUT);
     digitalWrite(MORSE_LED_PIN, LOW);
     Buzzer::begin();
     sendingMorse = false;
-    fsmState = FSM_CHECK_OUTPUT;
+    timerArmed = false;
+    charActive = false;
+    toneIsOn = false;
+    txQueue.reset();
+    doneQueue.reset();
+    startQueue.reset();
 }
 
 void MorseEngine::onElement(MorseElementCB cb) {
@@ -57,165 +112,266 @@ void MorseEngine::onCharDone(MorseCharDoneCB cb) {
     charDoneCB = cb;
 }
 
+void MorseEngine::onCharStart(MorseCharStartCB cb) {
+    charStartCB = cb;
+}
+
 bool MorseEngine::isSending() {
-    return sendingMorse;
+    return sendingMorse || !txQueue.empty();
+}
+
+uint8_t MorseEngine::queueFree() {
+    return (uint8_t)txQueue.free();
+}
+
+uint8_t MorseEngine::queueDepth() {
+    return (uint8_t)txQueue.size();
+}
+
+void MorseEngine::flush() {
+    // Consumer-owned tail moves here, so keep the ISR out briefly
+    noInterrupts();
+    txQueue.clear();
+    epoch++;
+    interrupts();
+}
+
+void MorseEngine::update() {
+    // The ISR can't remove itself: a callback's return value only sets
+    // when it runs next. Uninstall it here once the queue has drained, so
+    // an idle engine takes no timer1 interrupts at all.
+    if (timerArmed && !sendingMorse) {
+        setTimer1Callback(nullptr);
+        timerArmed = false;
+    }
+
+    bool on = toneIsOn;
+    if (on != reportedToneOn) {
+        reportedToneOn = on;
+        if (elementCB) elementCB(on);
+    }
+
+    // Deliver completions in send order; drop ones from before a flush()
+    DoneItem item;
+    while (doneQueue.pop(item)) {
+        if (item.epoch == epoch && charDoneCB) charDoneCB(item.ch, item.doneUs);
+    }
+
+    // Starts are reported even across a flush(): the character is on air
+    StartItem st;
+    while (startQueue.pop(st)) {
+        if (!charStartCB) continue;
+        MorseCharStart s;
+        s.ch = st.ch;
+        s.code.len = st.len;
+        s.code.bits = st.bits;
+        s.startUs = st.nowUs - st.lateCcy / clockCyclesPerMicrosecond();
+        s.ditUs = MorseTiming::toUs(st.ditQ);
+        s.gapUs = MorseTiming::toUs(st.gapQ);
+        charStartCB(s);
+    }
+
+    uint32_t lateCcy;
+    while (edgeSamples.pop(lateCcy)) {
+        edgeHist.record((uint32_t)((uint64_t)lateCcy * 1000 / clockCyclesPerMicrosecond()));
+    }
 }
 
-void MorseEngine::setSpeed(int wpm) {
+const LogHistogram& MorseEngine::edgeTiming() {
+    return edgeHist;
+}
+
+uint32_t MorseEngine::edgeTimingDropped() {
+    return edgeDropped;
+}
+
+void MorseEngine::resetEdgeTiming() {
+    edgeSamples.clear();
+    edgeDropped = 0;
+    edgeHist.reset();
+}
+
+void MorseEngine::setSpeed(int wpm, int effectiveWpm) {
     if (wpm < MIN_SPEED) wpm = MIN_SPEED;
     if (wpm > MAX_SPEED) wpm = MAX_SPEED;
+    if (effectiveWpm <= 0 || effectiveWpm > wpm) effectiveWpm = wpm;
+    if (effectiveWpm < MIN_SPEED) effectiveWpm = MIN_SPEED;
+
+    MorseTiming::Timing t = MorseTiming::compute(wpm, effectiveWpm);
+
+    // Applies from the next character; keep the ISR from loading a
+    // character against a half-written set of durations
+    noInterrupts();
     currentSpeed = wpm;
-    // Tick interval: 6000/wpm ms (rounded to nearest)
-    unsigned long interval = (6000UL + wpm / 2) / wpm;
-    if (interval < 1) interval = 1;
-    morseTicker.detach();
-    morseTicker.attach_ms(interval, transmitMorse);
+    effectiveSpeed = effectiveWpm;
+    timing = t;
+    interrupts();
 }
 
 int MorseEngine::getSpeed() {
     return currentSpeed;
 }
 
-int MorseEngine::getPattern(char ch, char* buf) {
-    return morseEncode(ch, buf);
+int MorseEngine::getEffectiveSpeed() {
+    return effectiveSpeed;
 }
 
-void MorseEngine::sendLetter(char encodeMorseChar) {
+MorseTiming::Timing MorseEngine::getTiming() {
+    noInterrupts();
+    MorseTiming::Timing t = timing;
+    interrupts();
+    return t;
+}
+
+MorseCode MorseEngine::getCode(char ch) {
+    return morseCodeFor(ch);
+}
+
+bool MorseEngine::sendLetter(char encodeMorseChar) {
+    if (queueFree() == 0) return false;
+
     // Convert to uppercase
     if (encodeMorseChar > 96) encodeMorseChar -= 32;
-    currentChar = encodeMorseChar;
 
-    char buf[7];
-    int n = morseEncode(encodeMorseChar, buf);
-
-    if (n == 0) {
+    MorseCode code = morseCodeFor(encodeMorseChar);
+    if (!code.valid()) {
         // Character not found — treat as space
-        buf[0] = ' ';
-        buf[1] = '\0';
-        n = 1;
+        code.len = 0;
+        code.bits = 0;
     }
 
-    // Copy to volatile signal string
-    for (int i = 0; i <= n; i++) {
-        morseSignalString[i] = buf[i];
+    TxItem item;
+    item.ch = encodeMorseChar;
+    item.len = code.len;
+    item.bits = code.bits;
+    item.epoch = epoch;
+    txQueue.push(item);
+
+    if (!sendingMorse) {
+        // Idle: arm the callback, it pulls the item and applies the first edge
+        nextEdgeCcy = ESP.getCycleCount();
+        sendingMorse = true;
+        setTimer1Callback(onTimer1);
+        timerArmed = true;
     }
-    morseSignals = n;
-    morseSignalPos = 0;
-
-    stepped = false;
-    fsmState = FSM_CHECK_OUTPUT;
-    sendingMorse = true;
-}
-
-// --- 15-state FSM (faithful port of original transmitMorse ISR) ---
-static void transmitMorse() {
-    stepped = false;
-    while (!stepped && sendingMorse) {
-        switch (fsmState) {
-            case FSM_CHECK_OUTPUT:
-                if (digitalRead(MORSE_LED_PIN) == LOW) fsmState = FSM_OUTPUT_LOW;
-                else fsmState = FSM_OUTPUT_HIGH;
-                break;
-
-            case FSM_OUTPUT_LOW:
-                fsmState = FSM_NEXT_ON; // default: turn on next element
-                if (morseSignalPos == 0) fsmState = FSM_FIRST_ON;
-                if (morseSignalString[morseSignalPos] == '\0') fsmState = FSM_CHAR_GAP;
-                if (morseSignalString[0] == ' ') fsmState = FSM_WORD_GAP;
-                break;
-
-            case FSM_OUTPUT_HIGH:
-                if (morseSignalString[morseSignalPos] == '.') fsmState = FSM_DOT_DONE;
-                else fsmState = FSM_DASH_TIMING;
-                break;
-
-            case FSM_FIRST_ON:
-                digitalWrite(MORSE_LED_PIN, HIGH);
-                Buzzer::toneOn();
-                if (elementCB) elementCB(true);
-                fsmState = FSM_OUTPUT_HIGH;
-                stepped = true;
-                tick = 0;
-                break;
-
-            case FSM_CHAR_GAP:
-                if (tick < END_TICKS) fsmState = FSM_CHAR_GAP_WAIT;
-                else fsmState = FSM_CHAR_DONE;
-                break;
-
-            case FSM_WORD_GAP:
-                if (tick < SPACE_TICKS) fsmState = FSM_WORD_GAP_WAIT;
-                else fsmState = FSM_WORD_DONE;
-                break;
-
-            case FSM_NEXT_ON:
-                digitalWrite(MORSE_LED_PIN, HIGH);
-                Buzzer::toneOn();
-                if (elementCB) elementCB(true);
-                stepped = true;
-                fsmState = FSM_OUTPUT_HIGH;
-                break;
-
-            case FSM_DASH_TIMING:
-                if (tick < DASH_TICKS) fsmState = FSM_DASH_TICK;
-                else fsmState = FSM_DASH_DONE;
-                break;
-
-            case FSM_DOT_DONE:
-                digitalWrite(MORSE_LED_PIN, LOW);
-                Buzzer::toneOff();
-                if (elementCB) elementCB(false);
-                morseSignalPos++;
-                fsmState = FSM_OUTPUT_LOW;
-                stepped = true;
-                break;
-
-            case FSM_CHAR_GAP_WAIT:
-                tick++;
-                fsmState = FSM_CHAR_GAP;
-                stepped = true;
-                break;
-
-            case FSM_CHAR_DONE:
-                tick = 0;
-                stepped = true;
-                sendingMorse = false;
-                if (charDoneCB) charDoneCB(currentChar);
-                break;
+    return true;
+}
+
+// --- Timer1 callback (interrupt context) ---
+// Returns CPU cycles until it needs to run again; the core clamps that
+// to its own minimum and keeps calling until the callback is removed,
+// which update() does once sendingMorse drops. The core may also call it
+// early (other waveforms share timer1), so every decision is made
+// against absolute cycle deadlines.
+
+static inline void IRAM_ATTR setTone(bool on) {
+    toneIsOn = on;
+    if (on) {
+        GPOS = (1 << MORSE_LED_PIN);
+        Buzzer::isrToneOn();
+    } else {
+        GPOC = (1 << MORSE_LED_PIN);
+        Buzzer::isrToneOff();
+    }
+}
 
-            case FSM_WORD_GAP_WAIT:
-                tick++;
-                fsmState = FSM_WORD_GAP;
-                stepped = true;
-                break;
+// Pull the next queued character and compile it into segments.
+// Returns false if the queue is empty.
+static bool IRAM_ATTR loadNextChar() {
+    TxItem item;
+    if (!txQueue.pop(item)) return false;
+
+    StartItem st;
+    st.ch = item.ch;
+    st.len = item.len;
+    st.bits = item.bits;
+    st.nowUs = micros();
+    st.lateCcy = ESP.getCycleCount() - nextEdgeCcy;
+    st.ditQ = timing.dit;
+    st.gapQ = item.len == 0 ? timing.wordGap - timing.interGap : timing.interGap;
+    startQueue.push(st);  // dropped if loop() fell a whole queue behind
+
+    uint8_t n = 0;
+    uint16_t onMask = 0;
+    if (item.len == 0) {
+        // Stretch the previous character's gap out to a word gap
+        timelineUs[n++] = timelineCursor.advance(timing.wordGap - timing.interGap);
+    } else {
+        for (uint8_t i = 0; i < item.len; i++) {
+            bool dah = (item.bits >> (item.len - 1 - i)) & 1;
+            onMask |= (1 << n);
+            timelineUs[n++] = timelineCursor.advance(dah ? timing.dah : timing.dit);
+            bool last = (i == item.len - 1);
+            timelineUs[n++] = timelineCursor.advance(last ? timing.interGap : timing.intraGap);
+        }
+    }
+    currentChar = item.ch;
+    currentEpoch = item.epoch;
+    timelineOnMask = onMask;
+    timelineLen = n;
+    timelinePos = 0;
+    return true;
+}
+
+static void IRAM_ATTR recordEdge(uint32_t lateCcy) {
+    if (!edgeSamples.push(lateCcy)) edgeDropped = edgeDropped + 1;
+}
+
+static void IRAM_ATTR charFinished() {
+    DoneItem item;
+    item.ch = currentChar;
+    item.epoch = currentEpoch;
+    item.doneUs = micros();
+    // Loop fell a whole queue behind: drop rather than overwrite unread slots
+    doneQueue.push(item);
+}
 
-            case FSM_WORD_DONE:
-                tick = 0;
+static uint32_t IRAM_ATTR onTimer1() {
+    // Drained, waiting for update() to uninstall us. Don't pick up a
+    // character queued meanwhile: sendLetter() restarts the timeline.
+    if (!sendingMorse) return ISR_IDLE_CCY;
+
+    uint32_t now = ESP.getCycleCount();
+
+    if ((int32_t)(nextEdgeCcy - now) <= 0) {
+        if (timelinePos >= timelineLen) {
+            // Final gap elapsed (or nothing started yet)
+            if (charActive) {
+                charActive = false;
+                charFinished();
+            }
+            if (!loadNextChar()) {
                 sendingMorse = false;
-                stepped = true;
-                if (charDoneCB) charDoneCB(currentChar);
-                break;
-
-            case FSM_DASH_DONE:
-                digitalWrite(MORSE_LED_PIN, LOW);
-                Buzzer::toneOff();
-                if (elementCB) elementCB(false);
-                tick = 0;
-                morseSignalPos++;
-                fsmState = FSM_CHECK_OUTPUT;
-                stepped = true;
-                break;
-
-            case FSM_DASH_TICK:
-                tick++;
-                fsmState = FSM_DASH_TIMING;
-                stepped = true;
-                break;
-
-            default:
-                fsmState = FSM_CHECK_OUTPUT;
-                break;
+                return ISR_IDLE_CCY;
+            }
+            charActive = true;
         }
+
+        uint8_t pos = timelinePos;
+        bool on = (timelineOnMask >> pos) & 1;
+        if (on != toneIsOn) {
+            setTone(on);
+            recordEdge(ESP.getCycleCount() - nextEdgeCcy);
+            if (on) nextToggleCcy = now + Buzzer::halfPeriodCycles();
+        }
+
+        // Advance from the ideal edge time, not from now, so ISR latency
+        // never accumulates across a character
+        nextEdgeCcy += microsecondsToClockCycles(timelineUs[pos]);
+        timelinePos = pos + 1;
+    }
+
+    uint32_t wait = nextEdgeCcy - now;
+
+    // Passive buzzer: drive the square wave from here while the tone is on
+    if (toneIsOn && !Buzzer::isActive()) {
+        if ((int32_t)(nextToggleCcy - now) <= 0) {
+            Buzzer::isrToggle();
+            nextToggleCcy += Buzzer::halfPeriodCycles();
+        }
+        uint32_t toggleWait = nextToggleCcy - now;
+        if (toggleWait < wait) wait = toggleWait;
     }
-    stepped = false;
+
+    return wait > 0 ? wait : 1;
 }
@@ -6,13 +6,25 @@
 #include "morse_engine.h"
 
 // --- Timing helpers ---
-static inline unsigned long ditTimeMs() {
-    return 1200UL / (unsigned long)trainer.getSpeed();
+// Same PARIS model the engine sends with, in whole microseconds, but at
+// the character speed with standard 3/7-unit gaps: the operator keys
+// with normal spacing even when the trainer sends Farnsworth-stretched
+// gaps, so the stretched ones would merge consecutive characters.
+struct KeyTiming {
+    unsigned long dit, dah, intraGap, interGap, wordGap;
+};
+
+static KeyTiming keyTiming() {
+    MorseTiming::Timing t = MorseTiming::compute(MorseEngine::getSpeed());
+    return KeyTiming{
+        MorseTiming::toUs(t.dit), MorseTiming::toUs(t.dah),
+        MorseTiming::toUs(t.intraGap), MorseTiming::toUs(t.interGap),
+        MorseTiming::toUs(t.wordGap)
+    };
 }
 
 // --- State ---
-static char patternBuf[8]; // max 6 elements + null
-static int patternLen = 0;
+static MorseCode keyed = { 0, 0 }; // elements keyed so far
 static unsigned long pressStart = 0;
 static unsigned long releaseTime = 0;
 static bool keyWasDown = false;
@@ -33,8 +45,7 @@ static bool dahMemory = false;
 
 void MorseKey::begin() {
     pinMode(KEY_DIT_PIN, INPUT_PULLUP);
-    patternLen = 0;
-    patternBuf[0] = '\0';
+    keyed = MorseCode{ 0, 0 };
     keyWasDown = false;
     spaceSent = false;
 }
@@ -43,8 +54,8 @@ void MorseKey::update() {
     if (!trainer.isRunning()) return;
 
     bool down = (digitalRead(KEY_DIT_PIN) == LOW);
-    unsigned long now = millis();
-    unsigned long dit = ditTimeMs();
+    unsigned long now = micros();
+    const KeyTiming t = keyTiming();
 
     if (down && !keyWasDown) {
         // Key just pressed
@@ -59,24 +70,21 @@ void MorseKey::update() {
         releaseTime = now;
 
         unsigned long duration = now - pressStart;
-        if (patternLen < 6) {
-            patternBuf[patternLen++] = (duration < 2 * dit) ? '.' : '-';
-            patternBuf[patternLen] = '\0';
-        }
-    } else if (!down && !keyWasDown && patternLen > 0) {
+        // Dash if closer to a dah than a dit
+        keyed.append(duration >= (t.dit + t.dah) / 2);
+    } else if (!down && !keyWasDown && keyed.len > 0) {
         // Key is up and we have accumulated pattern
         unsigned long idle = now - releaseTime;
 
-        if (idle > 3 * dit) {
+        if (idle > t.interGap) {
             // Character gap — decode and submit
-            char ch = morseDecode(patternBuf);
+            char ch = morseCharFor(keyed);
             if (ch) {
                 trainer.processInput(ch);
             }
-            patternLen = 0;
-            patternBuf[0] = '\0';
+            keyed = MorseCode{ 0, 0 };
 
-            if (idle > 7 * dit && !spaceSent) {
+            if (idle > t.wordGap && !spaceSent) {
                 trainer.processInput(' ');
                 spaceSent = true;
             }
@@ -91,8 +99,7 @@ void MorseKey::update() {
 void MorseKey::begin() {
     pinMode(KEY_DIT_PIN, INPUT_PULLUP);
     pinMode(KEY_DAH_PIN, INPUT_PULLUP);
-    patternLen = 0;
-    patternBuf[0] = '\0';
+    keyed = MorseCode{ 0, 0 };
     iState = IDLE;
     spaceSent = false;
     ditMemory = false;
@@ -104,9 +111,8 @@ void MorseKey::update() {
 
     bool ditDown = (digitalRead(KEY_DIT_PIN) == LOW);
     bool dahDown = (digitalRead(KEY_DAH_PIN) == LOW);
-    unsigned long now = millis();
-    unsigned long dit = ditTimeMs();
-    unsigned long dah = 3 * dit;
+    unsigned long now = micros();
+    const KeyTiming t = keyTiming();
 
     // Capture squeeze memories while elements are playing
     if (ditDown) ditMemory = true;
@@ -130,18 +136,17 @@ void MorseKey::update() {
                 dahMemory = false;
                 ditMemory = ditDown; // capture dit during dah start
                 spaceSent = false;
-            } else if (patternLen > 0) {
+            } else if (keyed.len > 0) {
                 // No paddle pressed — check for character/word gap
                 unsigned long idle = now - releaseTime;
-                if (idle > 3 * dit) {
-                    char ch = morseDecode(patternBuf);
+                if (idle > t.interGap) {
+                    char ch = morseCharFor(keyed);
                     if (ch) {
                         trainer.processInput(ch);
                     }
-                    patternLen = 0;
-                    patternBuf[0] = '\0';
+                    keyed = MorseCode{ 0, 0 };
 
-                    if (idle > 7 * dit && !spaceSent) {
+                    if (idle > t.wordGap && !spaceSent) {
                         trainer.processInput(' ');
                         spaceSent = true;
                     }
@@ -150,13 +155,10 @@ void MorseKey::update() {
             break;
 
         case DIT_ON:
-            if (now - elementStart >= dit) {
+            if (now - elementStart >= t.dit) {
                 // Dit tone complete — turn off
                 Buzzer::toneOff();
-                if (patternLen < 6) {
-                    patternBuf[patternLen++] = '.';
-                    patternBuf[patternLen] = '\0';
-                }
+                keyed.append(false);
                 lastWasDit = true;
                 iState = DIT_OFF;
                 elementStart = now;
@@ -165,7 +167,7 @@ void MorseKey::update() {
             break;
 
         case DIT_OFF:
-            if (now - elementStart >= dit) {
+            if (now - elementStart >= t.intraGap) {
                 // Inter-element gap complete
                 // Iambic Mode B: check memories for squeeze alternation
                 if (dahMemory) {
@@ -195,13 +197,10 @@ void MorseKey::update() {
             break;
 
         case DAH_ON:
-            if (now - elementStart >= dah) {
+            if (now - elementStart >= t.dah) {
                 // Dah tone complete — turn off
                 Buzzer::toneOff();
-                if (patternLen < 6) {
-                    patternBuf[patternLen++] = '-';
-                    patternBuf[patternLen] = '\0';
-                }
+                keyed.append(true);
                 lastWasDit = false;
                 iState = DAH_OFF;
                 elementStart = now;
@@ -210,7 +209,7 @@ void MorseKey::update() {
             break;
 
         case DAH_OFF:
-            if (now - elementStart >= dit) {
+            if (now - elementStart >= t.intraGap) {
                 // Inter-element gap complete
                 // Iambic Mode B: check memories for squeeze alternation
                 if (ditMemory) {
@@ -1,83 +1,120 @@
 #include "morse_table.h"
 
+// In-order layout of the morse binary tree: root (space) at index 63,
+// dit descends left, dah descends right.
+#define MORSE_TREE \
+    "*5*H*4*S***V*3*I***F***U?*_**2*E*&*L\"**R*+.****A***P@**W***J'1* *6-B*=*D*/" \
+    "*X***N***C;(!K***Y***T*7*Z**,G***Q***M:8*!***O*9***0*"
+
 const int morseTreetop = 63;
-const char morseTable[] PROGMEM =
-    "*5*H*4*S***V*3*I***F***U?*_**2*E*&*L\"**R*+.****A***P@**W***J'1* *6-B*=*D*/"
-    "*X***N***C;(!K***Y***T*7*Z**,G***Q***M:8*!***O*9***0*";
+const char morseTable[] PROGMEM = MORSE_TREE;
 
 const int morseTableLength = (morseTreetop * 2) + 1;
 const int morseTreeLevels = 6; // log2(64) = 6
 
-int morseEncode(char ch, char* buf) {
-    // Convert to uppercase
-    if (ch > 96) ch -= 32;
+// --- Compile-time lookup tables ---
+// Both directions are generated from MORSE_TREE so the tree string stays
+// the single source of truth. The tables live in DRAM (no PROGMEM) so they
+// can be read with plain loads, including from the timer ISR.
+
+namespace {
+
+struct MorseTables {
+    MorseCode encode[128]; // ASCII -> packed code
+    char decode[128];      // (1 << len) | bits -> ASCII, '\0' if unused
+};
 
-    // Find character in morse table
-    int i;
-    for (i = 0; i < morseTableLength; i++) {
-        if (pgm_read_byte(morseTable + i) == ch) break;
+constexpr MorseTables buildMorseTables() {
+    constexpr char tree[] = MORSE_TREE;
+    MorseTables t{};
+
+    // Walk every heap index to find its in-order tree position
+    int heapOfPos[(morseTreetop * 2) + 1] = {};
+    for (int heap = 1; heap < 128; heap++) {
+        int len = 0;
+        while ((heap >> (len + 1)) != 0) len++;
+
+        int pos = morseTreetop;
+        int step = (morseTreetop + 1) / 2;
+        for (int i = len - 1; i >= 0; i--) {
+            pos += ((heap >> i) & 1) ? step : -step;
+            step /= 2;
+        }
+        heapOfPos[pos] = heap;
+        t.decode[heap] = (tree[pos] == '*') ? '\0' : tree[pos];
     }
-    if (i >= morseTableLength) {
-        buf[0] = '\0';
-        return 0;
+
+    for (int c = 0; c < 128; c++) {
+        t.encode[c].len = MORSE_NO_CODE;
     }
 
-    int morseTablePos = i + 1; // 1-based
+    // Scan positions in table order so duplicates resolve like the old scan
+    for (int pos = 0; pos < (morseTreetop * 2) + 1; pos++) {
+        char ch = tree[pos];
+        if (ch == '*' || t.encode[(uint8_t)ch].len != MORSE_NO_CODE) continue;
+        int heap = heapOfPos[pos];
+        uint8_t len = 0;
+        while ((heap >> (len + 1)) != 0) len++;
+        t.encode[(uint8_t)ch].len = len;
+        t.encode[(uint8_t)ch].bits = (uint8_t)(heap & ((1 << len) - 1));
+    }
 
-    // Find level in binary tree
-    int test;
-    int startLevel;
-    for (startLevel = 0; startLevel < morseTreeLevels; startLevel++) {
-        test = (morseTablePos + (1 << startLevel)) % (2 << startLevel);
-        if (test == 0) break;
+    // Lowercase (anything above 96) maps to the character 32 below
+    for (int c = 97; c < 128; c++) {
+        t.encode[c] = t.encode[c - 32];
     }
-    int numSignals = morseTreeLevels - startLevel;
+    return t;
+}
+
+constexpr MorseTables morseTables = buildMorseTables();
+
+static_assert(morseTables.decode[1] == ' ', "tree root must be space");
+static_assert(morseTables.encode['E'].len == 1 && morseTables.encode['E'].bits == 0, "E is .");
+static_assert(morseTables.encode['0'].len == 5 && morseTables.encode['0'].bits == 0x1F, "0 is -----");
+
+} // namespace
 
-    if (numSignals <= 0) {
-        // Space character
+MorseCode morseCodeFor(char ch) {
+    uint8_t c = (uint8_t)ch;
+    if (c >= 128) return MorseCode{ MORSE_NO_CODE, 0 };
+    return morseTables.encode[c];
+}
+
+char morseCharFor(MorseCode code) {
+    if (code.len > MORSE_MAX_ELEMENTS) return '\0';
+    if (code.bits >> code.len) return '\0';  // bits beyond len: malformed
+    return morseTables.decode[(1 << code.len) | code.bits];
+}
+
+int morseCodeToString(MorseCode code, char* buf) {
+    if (!code.valid()) {
+        buf[0] = '\0';
+        return 0;
+    }
+
+    if (code.isSpace()) {
         buf[0] = ' ';
         buf[1] = '\0';
         return 1;
     }
 
-    int pos = 0;
-    int tPos = morseTablePos;
-    for (int j = startLevel; j < morseTreeLevels; j++) {
-        int add = (1 << j);
-        test = (tPos + add) / (2 << j);
-        if (test & 1) {
-            tPos += add;
-            buf[numSignals - 1 - pos++] = '.';
-        } else {
-            tPos -= add;
-            buf[numSignals - 1 - pos++] = '-';
-        }
+    for (uint8_t i = 0; i < code.len; i++) {
+        buf[i] = code.isDah(i) ? '-' : '.';
     }
-    buf[pos] = '\0';
-    return numSignals;
+    buf[code.len] = '\0';
+    return code.len;
+}
+
+int morseEncode(char ch, char* buf) {
+    return morseCodeToString(morseCodeFor(ch), buf);
 }
 
 char morseDecode(const char* pattern) {
-    int pos = morseTreetop; // root of tree (0-based index 63)
+    MorseCode code = { 0, 0 };
     for (int i = 0; pattern[i]; i++) {
-        int level = 0;
-        int tmp = pos + 1; // convert to 1-based for tree math
-        for (level = 0; level < morseTreeLevels; level++) {
-            if (((tmp + (1 << level)) % (2 << level)) == 0) break;
-        }
+        if (pattern[i] != '.' && pattern[i] != '-') return '\0';
         // Can't descend further
-        if (level == 0) return '\0';
-
-        int step = (1 << (level - 1));
-        if (pattern[i] == '.') {
-            pos -= step;
-        } else if (pattern[i] == '-') {
-            pos += step;
-        } else {
-            return '\0';
-        }
+        if (!code.append(pattern[i] == '-')) return '\0';
     }
-    if (pos < 0 || pos >= morseTableLength) return '\0';
-    char ch = pgm_read_byte(morseTable + pos);
-    return (ch == '*') ? '\0' : ch;
+    return morseCharFor(code);
 }
@@ -1,5 +1,6 @@
 #include "oled_display.h"
 #include "config.h"
+#include "morse_table.h"
 #include <U8g2lib.h>
 #include <Wire.h>
 
@@ -30,7 +31,7 @@ static int dProfile = 0;
 static bool dRunning = false;
 static bool dToneOn = false;
 static char dChar = ' ';
-static char dPattern[8] = "";
+static MorseCode dCode = { MORSE_NO_CODE, 0 };
 static bool dResultValid = false;
 static bool dCorrect = false;
 static int dQueueDist = 0;
@@ -73,9 +74,10 @@ static void drawScreen64() {
 
     // Line 3: morse pattern (centered)
     u8g2.setFont(u8g2_font_7x13_tf);
-    if (dPattern[0]) {
-        int w = u8g2.getStrWidth(dPattern);
-        u8g2.drawStr((128 - w) / 2, 52, dPattern);
+    char pattern[MORSE_MAX_ELEMENTS + 1];
+    if (morseCodeToString(dCode, pattern) > 0) {
+        int w = u8g2.getStrWidth(pattern);
+        u8g2.drawStr((128 - w) / 2, 52, pattern);
     }
 
     // Line 5: result, queue distance, probability
@@ -111,8 +113,9 @@ static void drawScreen32() {
     }
 
     u8g2.setFont(u8g2_font_6x10_tf);
-    if (dPattern[0]) {
-        u8g2.drawStr(82, 10, dPattern);
+    char pattern[MORSE_MAX_ELEMENTS + 1];
+    if (morseCodeToString(dCode, pattern) > 0) {
+        u8g2.drawStr(82, 10, pattern);
     }
 
     // Line 2: result, distance, probability
@@ -186,39 +189,41 @@ void OledDisplay::onTrainerEvent(const TrainerEvent& evt) {
 
     switch (evt.type) {
         case TrainerEvent::CHAR_SENT:
-            dChar = evt.sentChar;
-            strncpy(dPattern, evt.pattern, sizeof(dPattern) - 1);
-            dPattern[sizeof(dPattern) - 1] = '\0';
-            dQueueDist = evt.queueDist;
+            dChar = evt.sent.ch;
+            dCode = evt.sent.code;
+            dQueueDist = evt.sent.queueDist;
             dResultValid = false;
             break;
 
+        case TrainerEvent::CHAR_START:
+            break;
+
         case TrainerEvent::RESULT:
             dResultValid = true;
-            dCorrect = evt.correct;
-            dTypedChar = evt.typedChar;
-            dExpectedChar = evt.expectedChar;
-            dProb = evt.prob;
+            dCorrect = evt.result.correct;
+            dTypedChar = evt.result.typed;
+            dExpectedChar = evt.result.expected;
+            dProb = evt.result.prob;
             break;
 
         case TrainerEvent::SPEED_CHANGE:
-            dSpeed = evt.speed;
+            dSpeed = evt.state.speed;
             break;
 
         case TrainerEvent::SESSION_STATE:
-            dRunning = evt.running;
-            dSpeed = evt.speed;
-            if (evt.running) {
+            dRunning = evt.state.running;
+            dSpeed = evt.state.speed;
+            if (evt.state.running) {
                 dResultValid = false;
                 dChar = ' ';
-                dPattern[0] = '\0';
+                dCode.len = MORSE_NO_CODE;
             }
             break;
 
         case TrainerEvent::CONTEXT_LOST:
-            dSpeed = evt.speed;
+            dSpeed = evt.state.speed;
             dChar = ' ';
-            dPattern[0] = '\0';
+            dCode.len = MORSE_NO_CODE;
             dResultValid = false;
             break;
     }
@@ -1,18 +1,42 @@
 #include "serial_interface.h"
+#include "commands.h"
+#include "buzzer.h"
 #include "morse_engine.h"
 #include "storage.h"
 #include "config.h"
+#include "boot_timer.h"
+#include "metrics.h"
+#include "journal.h"
+#include "web_server.h"
+#include "log_buffer.h"
+#include <stdarg.h>
 
-static String inputBuffer;
+// Fixed size, so typing never touches the heap
+static Command::LineBuffer<CMD_LINE_MAX> inputLine;
+
+// Event lines on their way out, written only as the UART has room
+static LogBuffer<SERIAL_LOG_BYTES, SERIAL_LOG_LINE_MAX> serialLog;
+static SerialInterface::Verbosity level = (SerialInterface::Verbosity)SERIAL_LOG_LEVEL;
 
 static void printHelp() {
     Serial.println(F("=== Morse Trainer Commands ==="));
-    Serial.println(F("/start [profile] [speed]  - Start training (profile 0-9, speed 20-200)"));
+    Serial.println(F("/start [profile] [speed] [charspeed] - Start training (profile 0-9, speed 20-200)"));
+    Serial.println(F("                          charspeed > speed = Farnsworth, 0 = off"));
     Serial.println(F("/stop                     - Stop training"));
-    Serial.println(F("/speed N                  - Set speed to N WPM"));
+    Serial.println(F("/speed N                  - Set speed to N chars/min (shown as WPM; /5 = words/min)"));
     Serial.println(F("/profile N                - Set profile (0-9)"));
+    Serial.println(F("/pitch [N]                - Sidetone pitch, 300-1200 Hz"));
+    Serial.println(F("/buzzer_type [on|off]     - Active (on) or passive (off) buzzer"));
     Serial.println(F("/status                   - Show current status"));
     Serial.println(F("/probs                    - Show character probabilities"));
+    Serial.println(F("/timing [reset]           - Show transmit edge timing error"));
+    Serial.println(F("/confusion [reset]        - Show most confused character pairs"));
+    Serial.println(F("/drill [on|off]           - Drill the most confused pairs"));
+    Serial.println(F("/events [reset]           - Show event queue depth and drops per output"));
+    Serial.println(F("/lag [N]                  - Chars you may fall behind before context lost"));
+    Serial.println(F("/log [quiet|results|full] - Event lines printed (full adds [TX]), drops"));
+    Serial.println(F("/boot                     - Show how long each startup phase took"));
+    Serial.println(F("/metrics                  - Loop time, heap and queue metrics (Prometheus text)"));
     Serial.println(F("/help                     - Show this help"));
     Serial.println(F("/wifi [ap|sta] [ssid] [pass] - Configure WiFi"));
     Serial.println(F("Any other character       - Training input"));
@@ -21,8 +45,37 @@ static void printHelp() {
 static void printStatus() {
     Serial.print(F("Running: ")); Serial.println(trainer.isRunning() ? "yes" : "no");
     Serial.print(F("Speed: ")); Serial.print(trainer.getSpeed()); Serial.println(F(" WPM"));
+    Serial.print(F("Char speed: "));
+    if (trainer.getCharSpeed() > trainer.getSpeed()) {
+        Serial.print(trainer.getCharSpeed()); Serial.println(F(" WPM (Farnsworth)"));
+    } else {
+        Serial.println(F("off"));
+    }
     Serial.print(F("Profile: ")); Serial.println(trainer.getProfile());
     Serial.print(F("PlainText: ")); Serial.println(trainer.isPlainText() ? "yes" : "no");
+    Serial.print(F("Drill: ")); Serial.println(trainer.isDrill() ? "on" : "off");
+    Serial.print(F("Lag limit: ")); Serial.println(trainer.getLagLimit());
+    Serial.print(F("WiFi: ")); Serial.print(WebServer::wifiState());
+    if (strcmp(WebServer::wifiState(), "connecting") != 0) {
+        Serial.print(' '); Serial.print(WebServer::ipAddress());
+    }
+    Serial.println();
+    Storage::WriteStats cs = Storage::configStats();
+    Serial.printf("Config: %lu writes for %lu changes, last %lu us%s\n",
+                  (unsigned long)cs.flushes, (unsigned long)cs.changes,
+                  (unsigned long)cs.lastUs, cs.dirty ? ", changes pending" : "");
+    Storage::WriteStats ps = Storage::probsStats();
+    Storage::WriteStats xs = Storage::confusionStats();
+    Serial.printf("Learned: probs %lu writes, last %lu us; confusion %lu writes, last %lu us%s\n",
+                  (unsigned long)ps.flushes, (unsigned long)ps.lastUs,
+                  (unsigned long)xs.flushes, (unsigned long)xs.lastUs,
+                  (ps.dirty || xs.dirty) ? ", changes pending" : "");
+    Journal::Stats js = Journal::stats();
+    Serial.printf("Journal: %lu bytes, %lu results this boot, %lu page writes, %lu compactions",
+                  (unsigned long)js.fileBytes, (unsigned long)js.records,
+                  (unsigned long)js.pageWrites, (unsigned long)js.compactions);
+    if (js.compactFailures) Serial.printf(" (%lu failed)", (unsigned long)js.compactFailures);
+    Serial.println();
 }
 
 static void printProbs() {
@@ -37,106 +90,164 @@ static void printProbs() {
     }
 }
 
-static void processCommand(const String& cmd) {
-    if (cmd.startsWith("/start")) {
-        int profile = DEFAULT_PROFILE;
-        int speed = DEFAULT_SPEED;
-
-        // Parse optional arguments
-        int firstSpace = cmd.indexOf(' ', 1);
-        if (firstSpace > 0) {
-            String args = cmd.substring(firstSpace + 1);
-            args.trim();
-            int secondSpace = args.indexOf(' ');
-            if (secondSpace > 0) {
-                profile = args.substring(0, secondSpace).toInt();
-                speed = args.substring(secondSpace + 1).toInt();
-            } else {
-                profile = args.toInt();
-            }
-        }
+static void printTiming() {
+    const LogHistogram& h = MorseEngine::edgeTiming();
+    Serial.println(F("Edge timing error vs ideal (ns):"));
+    Serial.print(F("Edges: ")); Serial.print(h.count());
+    Serial.print(F("  dropped: ")); Serial.println(MorseEngine::edgeTimingDropped());
+    Serial.print(F("Mean: ")); Serial.print(h.mean());
+    Serial.print(F("  p50: <=")); Serial.print(h.percentile(50));
+    Serial.print(F("  p99: <=")); Serial.print(h.percentile(99));
+    Serial.print(F("  max: ")); Serial.println(h.max());
+    for (uint8_t i = 0; i < LogHistogram::BUCKETS; i++) {
+        if (h.bucketCount(i) == 0) continue;
+        Serial.print(F("  <=")); Serial.print(LogHistogram::bucketUpper(i));
+        Serial.print(F(": ")); Serial.println(h.bucketCount(i));
+    }
+}
 
-        profile = constrain(profile, 0, 9);
-        speed = constrain(speed, MIN_SPEED, MAX_SPEED);
-        Serial.print(F("Starting: profile=")); Serial.print(profile);
-        Serial.print(F(" speed=")); Serial.println(speed);
-        trainer.start(profile, speed);
+static void printConfusion() {
+    ConfusionMatrix::Entry top[10];
+    uint8_t n = trainer.getConfusion().top(top, 10);
+    Serial.print(F("Confused pairs (expected->typed), "));
+    Serial.print(trainer.getConfusion().size()); Serial.println(F(" tracked:"));
+    for (uint8_t i = 0; i < n; i++) {
+        Serial.print(F("  ")); Serial.print(top[i].expected);
+        Serial.print(F("->")); Serial.print(top[i].typed);
+        Serial.print(F(": ")); Serial.println(top[i].count);
     }
-    else if (cmd.startsWith("/stop")) {
-        trainer.stop();
-        Serial.println(F("Training stopped."));
+}
+
+static void printEvents() {
+    Serial.println(F("Event sinks (queued/max, delivered, dropped, coalesced):"));
+    for (uint8_t i = 0; i < eventBus.sinkCount(); i++) {
+        TrainerEventBus::Stats st = eventBus.stats(i);
+        Serial.print(F("  ")); Serial.print(eventBus.sinkName(i));
+        Serial.print(F(": ")); Serial.print(st.depth);
+        Serial.print('/'); Serial.print(st.maxDepth);
+        Serial.print(F(", ")); Serial.print(st.delivered);
+        Serial.print(F(", ")); Serial.print(st.dropped);
+        Serial.print(F(", ")); Serial.println(st.coalesced);
     }
-    else if (cmd.startsWith("/speed")) {
-        String arg = cmd.substring(6);
-        arg.trim();
-        if (arg.length() == 0) {
-            Serial.print(F("Current speed: ")); Serial.print(trainer.getSpeed());
-            Serial.println(F(" WPM"));
-        } else {
-            int sp = arg.toInt();
-            if (sp >= MIN_SPEED && sp <= MAX_SPEED) {
-                trainer.setSpeed(sp);
-                Serial.print(F("Speed set to ")); Serial.println(sp);
-            } else {
-                Serial.println(F("Speed must be 20-200"));
+}
+
+// text is the whole line, '/' included; its arguments are split in place
+static void processCommand(char* text) {
+    using namespace Command;
+    char* name = text + 1;
+    size_t len = strcspn(name, " ");
+    const Entry* e = find(name, len);
+    if (!e || !(e->via & VIA_SERIAL)) {
+        Serial.print(F("Unknown command: ")); Serial.println(text);
+        printHelp();
+        return;
+    }
+
+    LineArgs args(name + len, e->params);
+    Result r = run(e->id, args);
+    switch (e->id) {
+        case START: {
+            int charSpeed;
+            Serial.print(F("Starting: profile=")); Serial.print(trainer.getProfile());
+            Serial.print(F(" speed=")); Serial.print(trainer.getSpeed());
+            if (args.getInt("char_speed", charSpeed) && charSpeed >= 0) {
+                Serial.print(F(" charspeed=")); Serial.print(charSpeed);
             }
+            Serial.println();
+            break;
         }
-    }
-    else if (cmd.startsWith("/profile")) {
-        String arg = cmd.substring(8);
-        arg.trim();
-        if (arg.length() == 0) {
-            Serial.print(F("Current profile: ")); Serial.println(trainer.getProfile());
-        } else {
-            int p = arg.toInt();
-            if (p >= 0 && p <= 9) {
-                trainer.setProfile(p);
-                Serial.print(F("Profile set to ")); Serial.println(p);
+        case STOP:
+            Serial.println(F("Training stopped."));
+            break;
+        case SPEED:
+            if (r == SHOW) {
+                Serial.print(F("Current speed: ")); Serial.print(trainer.getSpeed());
+                Serial.println(F(" WPM"));
+            } else if (r == DONE) {
+                Serial.print(F("Speed set to ")); Serial.println(trainer.getSpeed());
             } else {
-                Serial.println(F("Profile must be 0-9"));
+                Serial.printf("Speed must be %d-%d\n", MIN_SPEED, MAX_SPEED);
             }
-        }
-    }
-    else if (cmd.startsWith("/status")) {
-        printStatus();
-    }
-    else if (cmd.startsWith("/probs")) {
-        printProbs();
-    }
-    else if (cmd.startsWith("/wifi")) {
-        String args = cmd.substring(6);
-        args.trim();
-        Storage::Config cfg;
-        Storage::loadConfig(cfg);
-
-        int sp1 = args.indexOf(' ');
-        if (sp1 < 0) {
-            Serial.print(F("WiFi mode: ")); Serial.println(cfg.wifiMode);
-            Serial.print(F("STA SSID: ")); Serial.println(cfg.staSSID);
-            Serial.println(F("Reboot to apply changes."));
-        } else {
-            cfg.wifiMode = args.substring(0, sp1);
-            String rest = args.substring(sp1 + 1);
-            int sp2 = rest.indexOf(' ');
-            if (sp2 > 0) {
-                cfg.staSSID = rest.substring(0, sp2);
-                cfg.staPass = rest.substring(sp2 + 1);
+            break;
+        case PROFILE:
+            if (r == SHOW) {
+                Serial.print(F("Current profile: ")); Serial.println(trainer.getProfile());
+            } else if (r == DONE) {
+                Serial.print(F("Profile set to ")); Serial.println(trainer.getProfile());
+            } else {
+                Serial.printf("Profile must be 0-%d\n", NUM_PROFILES - 1);
+            }
+            break;
+        case PITCH:
+            if (r == INVALID) {
+                Serial.printf("Pitch must be %d-%d Hz\n", MIN_TONE_FREQ, MAX_TONE_FREQ);
+            } else {
+                Serial.printf("Pitch: %d Hz\n", Buzzer::getFrequency());
+            }
+            break;
+        case BUZZER_TYPE:
+            if (r == INVALID) Serial.println(F("Usage: /buzzer_type on|off (on = active buzzer)"));
+            else Serial.printf("Buzzer: %s\n", Buzzer::isActive() ? "active" : "passive");
+            break;
+        case STATUS:
+            printStatus();
+            break;
+        case PROBS:
+            printProbs();
+            break;
+        case TIMING:
+            if (r == DONE) Serial.println(F("Edge timing reset."));
+            else printTiming();
+            break;
+        case CONFUSION:
+            if (r == DONE) Serial.println(F("Confusion matrix reset."));
+            else printConfusion();
+            break;
+        case DRILL:
+            Serial.print(F("Drill: ")); Serial.println(trainer.isDrill() ? "on" : "off");
+            break;
+        case BOOT:
+            SerialInterface::printBootReport();
+            break;
+        case METRICS:
+            metrics.render(Serial);
+            break;
+        case EVENTS:
+            printEvents();
+            break;
+        case LAG:
+            Serial.print(F("Lag limit: ")); Serial.println(trainer.getLagLimit());
+            break;
+        case LOG:
+            if (r == INVALID) {
+                Serial.println(F("Usage: /log quiet|results|full"));
             } else {
-                cfg.staSSID = rest;
-                cfg.staPass = "";
+                SerialInterface::LogStats ls = SerialInterface::logStats();
+                Serial.printf("Log: %s, %u bytes queued (max %u), %lu lines, %lu dropped\n",
+                              SerialInterface::verbosityName(SerialInterface::verbosity()),
+                              ls.queued, ls.maxQueued, (unsigned long)ls.lines,
+                              (unsigned long)ls.dropped);
             }
-            Storage::saveConfig(cfg);
-            Serial.print(F("WiFi configured: ")); Serial.print(cfg.wifiMode);
-            Serial.print(F(" SSID=")); Serial.println(cfg.staSSID);
-            Serial.println(F("Reboot to apply."));
+            break;
+        case WIFI: {
+            const Storage::Config& cfg = Storage::config();
+            if (r == SHOW) {
+                Serial.print(F("WiFi mode: ")); Serial.println(cfg.wifiMode);
+                Serial.print(F("STA SSID: ")); Serial.println(cfg.staSSID);
+                Serial.println(F("Reboot to apply changes."));
+            } else if (r == DONE) {
+                Serial.print(F("WiFi configured: ")); Serial.print(cfg.wifiMode);
+                Serial.print(F(" SSID=")); Serial.println(cfg.staSSID);
+                Serial.println(F("Reboot to apply."));
+            } else {
+                Serial.println(F("Usage: /wifi ap|sta ssid [pass] (SSID up to 32, pass up to 64 chars)"));
+            }
+            break;
         }
-    }
-    else if (cmd.startsWith("/help")) {
-        printHelp();
-    }
-    else {
-        Serial.print(F("Unknown command: ")); Serial.println(cmd);
-        printHelp();
+        case HELP:
+        default:
+            printHelp();
+            break;
     }
 }
 
@@ -145,72 +256,119 @@ void SerialInterface::begin() {
     Serial.println();
     Serial.println(F("=== ESP8266 Morse Trainer ==="));
     Serial.println(F("Type /help for commands"));
-    inputBuffer = "";
+    inputLine.clear();
 }
 
 void SerialInterface::update() {
+    serialLog.drain(Serial, Serial.availableForWrite());
+
     while (Serial.available()) {
         char c = Serial.read();
 
         if (c == '\n' || c == '\r') {
-            if (inputBuffer.length() > 0) {
-                if (inputBuffer.startsWith("/")) {
-                    processCommand(inputBuffer);
+            if (inputLine.length() > 0) {
+                if (inputLine.overflowed()) {
+                    Serial.printf("Line too long (max %d chars), ignored\n", CMD_LINE_MAX);
+                } else if (inputLine.c_str()[0] == '/') {
+                    processCommand(inputLine.c_str());
                 } else {
-                    // Send each character as training input
-                    for (unsigned int i = 0; i < inputBuffer.length(); i++) {
-                        trainer.processInput(inputBuffer[i]);
-                    }
+                    // Whole line as training input, aligned as one run
+                    trainer.processInput(inputLine.c_str(), inputLine.length());
                 }
-                inputBuffer = "";
+                inputLine.clear();
             }
+        } else if (trainer.isRunning() && c != '/' && inputLine.length() == 0) {
+            // Not in command mode and training is running: single chars go straight in
+            trainer.processInput(c);
         } else {
-            inputBuffer += c;
-            // If not in command mode and training is running, process single chars immediately
-            if (trainer.isRunning() && c != '/' && inputBuffer.length() == 1 && !inputBuffer.startsWith("/")) {
-                trainer.processInput(c);
-                inputBuffer = "";
-            }
+            inputLine.push(c);
         }
     }
 }
 
+void SerialInterface::printBootReport() {
+    for (uint8_t i = 0; i < bootTimer.count(); i++) {
+        const BootTimer::Phase& p = bootTimer.phase(i);
+        Serial.printf("[BOOT] %-8s %6lu.%lu ms%s\n", p.name,
+                      (unsigned long)(p.us / 1000), (unsigned long)(p.us % 1000 / 100),
+                      p.background ? "  (background)" : "");
+    }
+    Serial.printf("[BOOT] ready in %lu ms\n", (unsigned long)(bootTimer.readyUs() / 1000));
+}
+
+void SerialInterface::setVerbosity(Verbosity v) {
+    level = v;
+}
+
+SerialInterface::Verbosity SerialInterface::verbosity() {
+    return level;
+}
+
+const char* SerialInterface::verbosityName(Verbosity v) {
+    static const char* const NAMES[] = { "quiet", "results", "full" };
+    return v <= FULL ? NAMES[v] : "?";
+}
+
+void SerialInterface::log(const char* fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    serialLog.vappendf(fmt, ap);
+    va_end(ap);
+}
+
+SerialInterface::LogStats SerialInterface::logStats() {
+    const auto& st = serialLog.stats();
+    LogStats s;
+    s.lines = st.lines;
+    s.dropped = st.dropped;
+    s.bytes = st.bytes;
+    s.queued = serialLog.used();
+    s.maxQueued = st.maxUsed;
+    return s;
+}
+
+// One line per event (two for context lost), formatted into the log
 void SerialInterface::onTrainerEvent(const TrainerEvent& evt) {
+    if (level == QUIET) return;
     switch (evt.type) {
         case TrainerEvent::CHAR_SENT:
-            if (evt.sentChar != ' ') {
-                Serial.print(F("[TX] ")); Serial.print(evt.sentChar);
-                Serial.print(F(" (")); Serial.print(evt.pattern);
-                Serial.print(F(") dist=")); Serial.println(evt.queueDist);
+            if (level == FULL && evt.sent.ch != ' ') {
+                char pattern[MORSE_MAX_ELEMENTS + 1];
+                morseCodeToString(evt.sent.code, pattern);
+                log("[TX] %c (%s) dist=%u\n", evt.sent.ch, pattern, evt.sent.queueDist);
             }
             break;
 
-        case TrainerEvent::RESULT:
-            if (evt.correct) {
-                Serial.print(F("[OK] ")); Serial.print(evt.typedChar);
-                Serial.print(F(" prob=")); Serial.println(evt.prob);
+        case TrainerEvent::CHAR_START:
+            break;  // keying timeline, for the web sidetone only
+
+        case TrainerEvent::RESULT: {
+            // prob= stays last: the desktop client parses it to end of line
+            char lat[32] = "";
+            if (evt.result.latencyMs >= 0) {
+                snprintf(lat, sizeof(lat), " lat=%ld avg=%u",
+                         (long)evt.result.latencyMs, evt.result.latencyAvgMs);
+            }
+            if (evt.result.correct) {
+                log("[OK] %c%s prob=%u\n", evt.result.typed, lat, evt.result.prob);
             } else {
-                Serial.print(F("[ERR] typed=")); Serial.print(evt.typedChar);
-                Serial.print(F(" expected=")); Serial.print(evt.expectedChar);
-                Serial.print(F(" prob=")); Serial.println(evt.prob);
+                log("[ERR] typed=%c expected=%c%s prob=%u\n", evt.result.typed,
+                    evt.result.expected, lat, evt.result.prob);
             }
             break;
+        }
 
         case TrainerEvent::SPEED_CHANGE:
-            Serial.print(F("[SPEED] ")); Serial.print(evt.speed);
-            Serial.print(F(" WPM (")); Serial.print(evt.direction);
-            Serial.println(F(")"));
+            log("[SPEED] %u WPM (%s)\n", evt.state.speed, evt.state.direction);
             break;
 
         case TrainerEvent::SESSION_STATE:
-            Serial.print(F("[SESSION] "));
-            Serial.println(evt.running ? F("started") : F("stopped"));
+            log("[SESSION] %s\n", evt.state.running ? "started" : "stopped");
             break;
 
         case TrainerEvent::CONTEXT_LOST:
-            Serial.println(F("[CONTEXT LOST] Resynchronizing..."));
-            Serial.print(F("[SPEED] ")); Serial.print(evt.speed);
-            Serial.println(F(" WPM (down)"));
+            log("[CONTEXT LOST] Resynchronizing...\n");
+            log("[SPEED] %u WPM (down)\n", evt.state.speed);
             break;
     }
 }
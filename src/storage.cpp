@@ -1,34 +1,132 @@
 #include "storage.h"
 #include <LittleFS.h>
 #include <ArduinoJson.h>
+#include "write_behind.h"
+#include "prob_store.h"
+#include "profiles.h"
+
+static ProbStore probStore(LittleFS, PROBS_SLOT_A, PROBS_SLOT_B);
+
+// Starting weights for a profile's characters the store doesn't have
+static void presetProbs(uint8_t profile, uint8_t* out) {
+    const uint8_t* p = getProfile(profile == 0 ? 1 : profile);
+    for (int i = 0; i < CHAR_COUNT; i++) out[i] = p ? pgm_read_byte(p + i) : 0;
+}
+
+// Bring a /probs.dat from older firmware into the store as P0
+static void importLegacyProbs() {
+    File f = LittleFS.open(PROBS_FILE, "r");
+    if (!f) return;
+    uint8_t probs[CHAR_COUNT];
+    bool ok = f.size() == CHAR_COUNT && f.read(probs, CHAR_COUNT) == CHAR_COUNT;
+    f.close();
+    if (ok && probStore.put(0, probs)) LittleFS.remove(PROBS_FILE);
+}
 
 bool Storage::begin() {
     return LittleFS.begin();
 }
 
-bool Storage::saveProbs(const uint8_t probs[CHAR_COUNT]) {
-    File f = LittleFS.open(PROBS_FILE, "w");
+void Storage::restoreProbs() {
+    if (!probStore.load(presetProbs)) importLegacyProbs();
+}
+
+// Probabilities and confusions waiting to be written, each with its
+// write-behind state
+struct LearnedFile {
+    WriteBehind writer{LEARNED_FLUSH_DELAY_MS};
+    uint32_t failures = 0;
+    uint32_t lastUs = 0;
+    LogHistogram flushUs;
+};
+static LearnedFile probsFile;
+static LearnedFile confusionFile;
+static const ConfusionMatrix* confusionSrc = nullptr;
+
+bool Storage::saveProbs(uint8_t profile, const uint8_t probs[CHAR_COUNT]) {
+    if (profile >= NUM_PROFILES) return false;
+    if (probStore.setEach((uint16_t)((1u << profile) | 1u), probs)) probsFile.writer.mark(1, millis());
+    return true;
+}
+
+bool Storage::loadProbs(uint8_t profile, uint8_t probs[CHAR_COUNT]) {
+    return probStore.get(profile, probs);
+}
+
+void Storage::saveConfusion(const ConfusionMatrix& m) {
+    confusionSrc = &m;
+    confusionFile.writer.mark(1, millis());
+}
+
+static bool writeProbs() {
+    return probStore.save();
+}
+
+static bool writeConfusion() {
+    File f = LittleFS.open(CONFUSION_FILE, "w");
     if (!f) return false;
-    f.write(probs, CHAR_COUNT);
+    bool ok = f.write((const uint8_t*)confusionSrc->raw(), ConfusionMatrix::BYTES) ==
+              ConfusionMatrix::BYTES;
     f.close();
-    return true;
+    return ok;
 }
 
-bool Storage::loadProbs(uint8_t probs[CHAR_COUNT]) {
-    File f = LittleFS.open(PROBS_FILE, "r");
+static void flushLearned(LearnedFile& file, bool (*write)()) {
+    uint32_t fields = file.writer.take();
+    if (!fields) return;
+    uint32_t startUs = micros();
+    bool ok = write();
+    file.lastUs = micros() - startUs;
+    file.flushUs.record(file.lastUs);
+    if (!ok) {
+        file.failures++;
+        file.writer.mark(fields, millis());  // try again after the delay
+    }
+}
+
+void Storage::updateLearned(bool idle) {
+    uint32_t now = millis();
+    // One file per pass: each is a stall of its own
+    if (probsFile.writer.due(now, idle)) {
+        flushLearned(probsFile, writeProbs);
+    } else if (confusionFile.writer.due(now, idle)) {
+        flushLearned(confusionFile, writeConfusion);
+    }
+}
+
+bool Storage::loadConfusion(ConfusionMatrix& m) {
+    File f = LittleFS.open(CONFUSION_FILE, "r");
     if (!f) return false;
-    if (f.size() != CHAR_COUNT) {
+    if (f.size() != ConfusionMatrix::BYTES) {
         f.close();
         return false;
     }
-    f.read(probs, CHAR_COUNT);
+    ConfusionMatrix::Entry raw[CONFUSION_SLOTS];
+    f.read((uint8_t*)raw, ConfusionMatrix::BYTES);
     f.close();
+    m.load(raw);
     return true;
 }
 
-bool Storage::saveConfig(const Config& cfg) {
+// Resident config and its write-behind state
+static Storage::Config cfg;
+static WriteBehind cfgWriter(CONFIG_FLUSH_DELAY_MS);
+static uint32_t cfgFailures = 0;
+static uint32_t cfgLastUs = 0;
+static LogHistogram cfgFlushUs;
+
+template<typename T>
+static void setField(T& field, T value, uint8_t bit) {
+    if (field == value) return;
+    field = value;
+    cfgWriter.mark(bit, millis());
+}
+
+static bool writeConfig() {
     JsonDocument doc;
     doc["speed"] = cfg.speed;
+    doc["charSpeed"] = cfg.charSpeed;
+    doc["lagLimit"] = cfg.lagLimit;
     doc["profile"] = cfg.profile;
     doc["buzzerActive"] = cfg.buzzerActive;
     doc["wifiMode"] = cfg.wifiMode;
@@ -42,7 +140,7 @@ bool Storage::saveConfig(const Config& cfg) {
     return true;
 }
 
-bool Storage::loadConfig(Config& cfg) {
+bool Storage::loadConfig() {
     File f = LittleFS.open(CONFIG_FILE, "r");
     if (!f) return false;
 
@@ -52,10 +150,108 @@ bool Storage::loadConfig(Config& cfg) {
     if (err) return false;
 
     cfg.speed = doc["speed"] | DEFAULT_SPEED;
+    cfg.charSpeed = doc["charSpeed"] | 0;
+    cfg.lagLimit = doc["lagLimit"] | CONTEXT_LOST_DIST;
     cfg.profile = doc["profile"] | DEFAULT_PROFILE;
     cfg.buzzerActive = doc["buzzerActive"] | BUZZER_ACTIVE_DEFAULT;
-    cfg.wifiMode = doc["wifiMode"] | "ap";
-    cfg.staSSID = doc["staSSID"] | "";
-    cfg.staPass = doc["staPass"] | "";
+    strlcpy(cfg.wifiMode, doc["wifiMode"] | "ap", sizeof(cfg.wifiMode));
+    strlcpy(cfg.staSSID, doc["staSSID"] | "", sizeof(cfg.staSSID));
+    strlcpy(cfg.staPass, doc["staPass"] | "", sizeof(cfg.staPass));
     return true;
 }
+
+const Storage::Config& Storage::config() {
+    return cfg;
+}
+
+void Storage::setSpeed(int wpm) {
+    setField(cfg.speed, (int16_t)wpm, CFG_SPEED);
+}
+
+void Storage::setCharSpeed(int wpm) {
+    setField(cfg.charSpeed, (int16_t)wpm, CFG_CHAR_SPEED);
+}
+
+void Storage::setLagLimit(int chars) {
+    setField(cfg.lagLimit, (int16_t)chars, CFG_LAG_LIMIT);
+}
+
+void Storage::setProfile(int profile) {
+    setField(cfg.profile, (int8_t)profile, CFG_PROFILE);
+}
+
+void Storage::setBuzzerActive(bool active) {
+    setField(cfg.buzzerActive, active, CFG_BUZZER);
+}
+
+bool Storage::setWifi(const char* mode, const char* ssid, const char* pass) {
+    if (strcmp(mode, "ap") != 0 && strcmp(mode, "sta") != 0) return false;
+    if (strlen(ssid) >= sizeof(cfg.staSSID) || strlen(pass) >= sizeof(cfg.staPass)) return false;
+    if (strcmp(mode, cfg.wifiMode) == 0 && strcmp(ssid, cfg.staSSID) == 0 &&
+        strcmp(pass, cfg.staPass) == 0) {
+        return true;
+    }
+    strlcpy(cfg.wifiMode, mode, sizeof(cfg.wifiMode));
+    strlcpy(cfg.staSSID, ssid, sizeof(cfg.staSSID));
+    strlcpy(cfg.staPass, pass, sizeof(cfg.staPass));
+    cfgWriter.mark(CFG_WIFI, millis());
+    return true;
+}
+
+void Storage::updateConfig(bool idle) {
+    if (cfgWriter.due(millis(), idle)) flushConfig();
+}
+
+bool Storage::flushConfig() {
+    uint32_t fields = cfgWriter.take();
+    if (!fields) return true;
+    uint32_t startUs = micros();
+    bool ok = writeConfig();
+    cfgLastUs = micros() - startUs;
+    cfgFlushUs.record(cfgLastUs);
+    if (!ok) {
+        cfgFailures++;
+        cfgWriter.mark(fields, millis());  // try again after the delay
+    }
+    return ok;
+}
+
+Storage::WriteStats Storage::configStats() {
+    WriteStats st;
+    st.dirty = (uint8_t)cfgWriter.dirty();
+    st.changes = cfgWriter.changes();
+    st.flushes = cfgWriter.writes();
+    st.failures = cfgFailures;
+    st.lastUs = cfgLastUs;
+    return st;
+}
+
+const LogHistogram& Storage::configFlushTiming() {
+    return cfgFlushUs;
+}
+
+static Storage::WriteStats learnedStats(const LearnedFile& file) {
+    Storage::WriteStats st;
+    st.dirty = (uint8_t)file.writer.dirty();
+    st.changes = file.writer.changes();
+    st.flushes = file.writer.writes();
+    st.failures = file.failures;
+    st.lastUs = file.lastUs;
+    return st;
+}
+
+Storage::WriteStats Storage::probsStats() {
+    return learnedStats(probsFile);
+}
+
+Storage::WriteStats Storage::confusionStats() {
+    return learnedStats(confusionFile);
+}
+
+const LogHistogram& Storage::probsFlushTiming() {
+    return probsFile.flushUs;
+}
+
+const LogHistogram& Storage::confusionFlushTiming() {
+    return confusionFile.flushUs;
+}
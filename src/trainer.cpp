@@ -4,67 +4,78 @@
 #include "storage.h"
 
 Trainer trainer;
+TrainerEventBus eventBus;
+
+static_assert(QUEUE_LENGTH >= TX_LOOKAHEAD + MAX_LAG_DIST + InputAligner::MAX_SENT,
+              "QUEUE_LENGTH must hold the lookahead, the lag limit and the aligner window");
+
+// Dit length the engine is sending with, for event payloads
+static uint32_t currentDitUs() {
+    return MorseTiming::toUs(MorseEngine::getTiming().dit);
+}
 
 void Trainer::begin() {
     memset(_charProb, 0, sizeof(_charProb));
-    memset(_queue, ' ', sizeof(_queue));
+    _sampler.clear();
+    memset(_latencyEwma, 0, sizeof(_latencyEwma));
+    _confusion.clear();
+    Storage::loadConfusion(_confusion);
     _running = false;
     _plainText = false;
-    _queueIndexS = 0;
-    _queueIndexR = 0;
-    _lGroup = 0;
-    _statErrors = 0;
-    _statGroup = 0;
-    _recoverySpaces = 0;
+    resetQueue();
+}
+
+void Trainer::seed(uint32_t s) {
+    _rng.seed(s);
 }
 
 void Trainer::onEvent(TrainerEventCB cb) {
     _eventCB = cb;
 }
 
-void Trainer::start(int profile, int speed) {
-    // Reset queue
-    memset(_queue, ' ', sizeof(_queue));
-    _queueIndexS = 0;
-    _queueIndexR = 0;
-    _lGroup = 0;
-    _statErrors = 0;
-    _statGroup = 0;
-    _recoverySpaces = 0;
+void Trainer::start(int profile, int speed, int charSpeed) {
+    MorseEngine::flush();
+    resetQueue();
     _plainText = false;
 
     _speed = constrain(speed, MIN_SPEED, MAX_SPEED);
+    if (charSpeed >= 0) setCharSpeed(charSpeed);
     _profile = profile;
 
     loadProfile(profile);
+    refreshDrill();
 
-    MorseEngine::setSpeed(_speed);
+    applySpeed();
     _running = true;
 
     TrainerEvent evt;
     evt.type = TrainerEvent::SESSION_STATE;
-    evt.running = true;
-    evt.speed = _speed;
+    evt.state.running = true;
+    evt.state.speed = _speed;
+    evt.state.charSpeed = _charSpeed;
+    evt.state.ditUs = currentDitUs();
     emitEvent(evt);
 }
 
 void Trainer::stop() {
     _running = false;
+    MorseEngine::flush();
 
-    // Save probabilities
-    Storage::saveProbs(_charProb);
-
-    // Save config (load first to preserve WiFi/buzzer settings)
-    Storage::Config cfg;
-    Storage::loadConfig(cfg);
-    cfg.speed = _speed;
-    cfg.profile = _profile;
-    Storage::saveConfig(cfg);
+    // Save probabilities, confusions and settings; all are written from
+    // loop() once the engine is idle, never inside the command
+    Storage::saveProbs(_profile, _charProb);
+    Storage::saveConfusion(_confusion);
+    Storage::setSpeed(_speed);
+    Storage::setCharSpeed(_charSpeed);
+    Storage::setLagLimit(_lagLimit);
+    Storage::setProfile(_profile);
 
     TrainerEvent evt;
     evt.type = TrainerEvent::SESSION_STATE;
-    evt.running = false;
-    evt.speed = _speed;
+    evt.state.running = false;
+    evt.state.speed = _speed;
+    evt.state.charSpeed = _charSpeed;
+    evt.state.ditUs = currentDitUs();
     emitEvent(evt);
 }
 
@@ -74,28 +85,22 @@ bool Trainer::isRunning() const {
 
 void Trainer::update() {
     if (!_running) return;
-    if (MorseEngine::isSending()) return;
 
-    // Drain recovery spaces non-blockingly (one per tick)
-    if (_recoverySpaces > 0) {
-        MorseEngine::sendLetter(' ');
-        _recoverySpaces--;
-        return;
-    }
-
-    sendNextChar();
-
-    if (queueDist() >= CONTEXT_LOST_DIST) {
-        contextLost();
-    }
-
-    if (_statGroup >= STAT_LENGTH) {
-        analyzeSpeed();
-        _statGroup = 0;
+    // Keep up to a group queued ahead so loop() stalls never stretch gaps
+    while (MorseEngine::queueFree() > 0) {
+        // Drain recovery spaces first
+        if (_recoverySpaces > 0) {
+            MorseEngine::sendLetter(' ');
+            _recoverySpaces--;
+            _recoveryInFlight++;
+            continue;
+        }
+        if (queueAhead() >= TX_LOOKAHEAD || _queue.full()) break;
+        queueNextChar();
     }
 }
 
-void Trainer::sendNextChar() {
+void Trainer::queueNextChar() {
     char ch;
     if (_lGroup < GROUP_LENGTH) {
         ch = generateLetter();
@@ -105,18 +110,53 @@ void Trainer::sendNextChar() {
         _lGroup = 0;
     }
 
-    _queue[_queueIndexS] = ch;
+    QueuedChar q = { ch, 0 };
+    _queue.push(q);
     MorseEngine::sendLetter(ch);
+}
+
+void Trainer::onCharStart(const MorseCharStart& start) {
+    if (!_running || start.code.isSpace()) return;
 
     TrainerEvent evt;
-    evt.type = TrainerEvent::CHAR_SENT;
-    evt.sentChar = ch;
-    MorseEngine::getPattern(ch, evt.pattern);
-    evt.queueDist = queueDist();
+    evt.type = TrainerEvent::CHAR_START;
+    evt.tone.ch = start.ch;
+    evt.tone.code = start.code;
+    evt.tone.startUs = start.startUs;
+    evt.tone.ditUs = start.ditUs;
+    evt.tone.gapUs = start.gapUs;
     emitEvent(evt);
+}
+
+void Trainer::onCharDone(char ch, uint32_t doneUs) {
+    if (!_running) return;
 
-    _queueIndexS = indexAdv(_queueIndexS);
+    if (_recoveryInFlight > 0) {
+        _recoveryInFlight--;
+        return;
+    }
+
+    _queue.at(_sentSeq).doneUs = doneUs;
+    _sentSeq++;
     _statGroup++;
+
+    TrainerEvent evt;
+    evt.type = TrainerEvent::CHAR_SENT;
+    evt.sent.ch = ch;
+    evt.sent.code = MorseEngine::getCode(ch);
+    evt.sent.queueDist = queueDist();
+    evt.sent.durationUs = MorseTiming::toUs(MorseTiming::charQ(MorseEngine::getTiming(), evt.sent.code));
+    emitEvent(evt);
+
+    if (queueDist() >= _lagLimit) {
+        contextLost();
+    }
+
+    if (_statGroup >= STAT_LENGTH) {
+        analyzeSpeed();
+        refreshDrill();
+        _statGroup = 0;
+    }
 }
 
 void Trainer::processInput(char ch) {
@@ -125,38 +165,122 @@ void Trainer::processInput(char ch) {
     // Make uppercase
     if (ch > 96) ch -= 32;
 
+    if (ch != ' ') {
+        alignInput(ch);
+        return;
+    }
+
     // Space: synchronize with sender
-    if (ch == ' ') {
-        while (_queue[_queueIndexR] != ' ' && queueDist() > 0) {
-            wrong(' ', _queue[_queueIndexR]);
-            _queueIndexR = indexAdv(_queueIndexR);
-        }
+    while (_queue.peek().ch != ' ' && queueDist() > 0) {
+        wrong(' ', _queue.peek().ch, -1);
+        _queue.skip();
     }
 
-    if (_queue[_queueIndexR] == ch) {
-        correct(ch);
+    if (_queue.peek().ch == ch) {
+        correct(ch, measureLatency());
     } else {
-        // Check if next character matches (one char lost during reception)
-        int nextIdx = indexAdv(_queueIndexR);
-        if (_queue[nextIdx] == ch) {
-            wrong(_queue[_queueIndexR], _queue[_queueIndexR]);
-            _queueIndexR = indexAdv(_queueIndexR);
-            correct(ch);
-        } else {
-            wrong(ch, _queue[_queueIndexR]);
-        }
+        wrong(ch, _queue.peek().ch, measureLatency());
     }
 
-    // Prevent underrun
-    if (queueDist() == 0) _queueIndexR = _queueIndexS;
+    advanceReceive();
+
+    // Word boundary: start a fresh alignment window
+    _alignBase = _queue.tail();
+    _alignLen = 0;
+    _alignScored = 0;
+}
+
+void Trainer::processInput(const char* text, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        processInput(text[i]);
+    }
+}
+
+// Score a non-space keypress. The recent typed chars are aligned against
+// the sent chars from _alignBase, so a missed, doubled or extra char is
+// one error and later answers line up again instead of all going wrong.
+void Trainer::alignInput(char ch) {
+    using namespace InputAligner;
+
+    int offR = SendQueue::distance(_alignBase, _queue.tail());
+    if (offR < 0 || offR > _alignLen + BAND) {
+        // Drifted out of the band (e.g. after an underrun): start over
+        _alignBase = _queue.tail();
+        _alignLen = 0;
+        _alignScored = 0;
+        offR = 0;
+    }
+
+    // Sent chars from the base through the one in flight (or the
+    // receive point if that is ahead), but never past the last one
+    // queued: with nothing in flight (recovery spaces, a starved engine)
+    // the slot at the head holds a blank or a long-gone character
+    int last = max((int)SendQueue::distance(_alignBase, _sentSeq), offR);
+    last = min(last, (int)SendQueue::distance(_alignBase, _queue.head()) - 1);
+    uint8_t nSent = (uint8_t)constrain(last + 1, 0, (int)MAX_SENT);
+    char sent[MAX_SENT];
+    for (uint8_t i = 0; i < nSent; i++) {
+        sent[i] = _queue.at(_alignBase + i).ch;
+    }
+
+    char typed[MAX_TYPED];
+    memcpy(typed, _alignTyped, _alignLen);
+    typed[_alignLen] = ch;
+    uint8_t nTyped = _alignLen + 1;
+    int8_t pos[MAX_TYPED];
+    align(sent, nSent, typed, nTyped, pos);
+
+    // An empty window lines nothing up: the keystroke is extra
+    int8_t p = nSent > 0 ? pos[nTyped - 1] : EXTRA;
+    // Re-matching what the previous keystroke already matched is a repeat
+    if (p != EXTRA && p < offR && nTyped > 1 && typed[nTyped - 2] == sent[p]) p = EXTRA;
+
+    if (p == EXTRA) {
+        // Nothing sent lines up with this keystroke
+        wrong(ch, ch, -1);
+    } else {
+        Step st = step(p, (uint8_t)offR, _alignScored);
+        // Sent chars passed over were missed (word spaces don't count)
+        for (; offR < p; offR++) {
+            char missed = _queue.peek().ch;
+            if ((st.missed & (1u << offR)) && missed != ' ') wrong(missed, missed, -1);
+            _queue.skip();
+        }
+        // An earlier keystroke turned out to be extra: step back to p
+        if (offR > p) _queue.rewind(offR - p);
+
+        // Score it, unless an earlier keystroke already was against this char
+        if (st.score) {
+            if (_queue.peek().ch == ch) {
+                correct(ch, measureLatency());
+            } else {
+                wrong(ch, _queue.peek().ch, measureLatency());
+            }
+        }
+
+        advanceReceive();
+    }
 
-    _queueIndexR = indexAdv(_queueIndexR);
+    // Slide the window, rebasing past the oldest typed char's sent slot
+    if (nTyped < MAX_TYPED) {
+        _alignTyped[_alignLen++] = ch;
+    } else {
+        if (pos[0] != EXTRA) {
+            _alignBase += pos[0] + 1;
+            _alignScored >>= pos[0] + 1;
+        }
+        memmove(_alignTyped, typed + 1, MAX_TYPED - 1);
+    }
 }
 
 int Trainer::getSpeed() const {
     return _speed;
 }
 
+int Trainer::getCharSpeed() const {
+    return _charSpeed;
+}
+
 int Trainer::getProfile() const {
     return _profile;
 }
@@ -169,17 +293,63 @@ bool Trainer::isPlainText() const {
     return _plainText;
 }
 
+const ConfusionMatrix& Trainer::getConfusion() const {
+    return _confusion;
+}
+
+bool Trainer::isDrill() const {
+    return _drill;
+}
+
+int Trainer::getLagLimit() const {
+    return _lagLimit;
+}
+
+uint16_t Trainer::getLatencyMs(char ch) const {
+    int idx = ch - FIRST_CHAR;
+    if (idx < 0 || idx >= CHAR_COUNT) return 0;
+    return (_latencyEwma[idx] + (1 << (LATENCY_EWMA_SHIFT - 1))) >> LATENCY_EWMA_SHIFT;
+}
+
+void Trainer::setDrill(bool on) {
+    _drill = on;
+    refreshDrill();
+}
+
+void Trainer::resetConfusion() {
+    _confusion.clear();
+    _drillCount = 0;
+    Storage::saveConfusion(_confusion);
+}
+
 void Trainer::setSpeed(int wpm) {
     _speed = constrain(wpm, MIN_SPEED, MAX_SPEED);
-    MorseEngine::setSpeed(_speed);
+    applySpeed();
 
     TrainerEvent evt;
     evt.type = TrainerEvent::SPEED_CHANGE;
-    evt.speed = _speed;
-    evt.direction = "set";
+    evt.state.speed = _speed;
+    evt.state.ditUs = currentDitUs();
+    evt.state.direction = "set";
     emitEvent(evt);
 }
 
+void Trainer::setCharSpeed(int wpm) {
+    _charSpeed = (wpm <= 0) ? 0 : constrain(wpm, MIN_SPEED, MAX_SPEED);
+    applySpeed();
+}
+
+// Elements go out at the character speed (never slower than the effective
+// speed); the engine stretches the gaps to bring the overall rate down.
+void Trainer::applySpeed() {
+    int charSpeed = (_charSpeed > _speed) ? _charSpeed : _speed;
+    MorseEngine::setSpeed(charSpeed, _speed);
+}
+
+void Trainer::setLagLimit(int chars) {
+    _lagLimit = constrain(chars, 1, MAX_LAG_DIST);
+}
+
 void Trainer::setProfile(int p) {
     if (p < 0 || p > 9) return;
     _profile = p;
@@ -188,138 +358,235 @@ void Trainer::setProfile(int p) {
 
 // --- Private ---
 
+// Sent characters not answered yet (0 while answering ahead of the sender)
 int Trainer::queueDist() const {
-    int d = _queueIndexS - _queueIndexR;
-    if (d < 0) d += QUEUE_LENGTH + 1;
-    return d;
+    int d = SendQueue::distance(_queue.tail(), _sentSeq);
+    return d > 0 ? d : 0;
 }
 
-int Trainer::indexAdv(int index) const {
-    index++;
-    if (index == QUEUE_LENGTH) index = 0;
-    return index;
+// Characters queued in the engine but not yet sent
+int Trainer::queueAhead() const {
+    return SendQueue::distance(_sentSeq, _queue.head());
+}
+
+// Step past the answered character. Answering the character still being
+// sent is allowed; past that the receive point stays put (underrun).
+void Trainer::advanceReceive() {
+    if (SendQueue::distance(_queue.tail(), _sentSeq) >= 0) _queue.skip();
 }
 
 char Trainer::generateLetter() {
-    int totProb = 0;
-    for (int i = 0; i < CHAR_COUNT; i++) {
-        totProb += _charProb[i];
-    }
-    if (totProb == 0) return 'E'; // fallback
-
-    int pointer = random(0, totProb);
-    int sum = 0;
-    int index = 0;
-    while (sum <= pointer && index < CHAR_COUNT) {
-        sum += _charProb[index];
-        index++;
+    if (_drill && _drillCount > 0 && _rng.below(100) < DRILL_MIX) {
+        char ch = generateDrillLetter();
+        if (ch) return ch;
     }
-    return (char)(FIRST_CHAR + index - 1);
+
+    uint16_t index = _sampler.sample(_rng);
+    if (index >= CHAR_COUNT) return 'E'; // fallback
+    return (char)(FIRST_CHAR + index);
+}
+
+// One side of a top confused pair, pairs weighted by count. Sides the
+// current profile never sends are skipped. Returns 0 if none qualify.
+char Trainer::generateDrillLetter() {
+    uint16_t total = 0;
+    for (uint8_t i = 0; i < _drillCount; i++) total += _drillPairs[i].count;
+    uint16_t pick = _rng.below(total);
+    uint8_t i = 0;
+    while (pick >= _drillPairs[i].count) pick -= _drillPairs[i++].count;
+
+    char a = _drillPairs[i].expected;
+    char b = _drillPairs[i].typed;
+    if (_rng.below(2)) { char t = a; a = b; b = t; }
+    if (_charProb[a - FIRST_CHAR] != 0) return a;
+    if (_charProb[b - FIRST_CHAR] != 0) return b;
+    return 0;
+}
+
+void Trainer::refreshDrill() {
+    _drillCount = _drill ? _confusion.top(_drillPairs, DRILL_PAIRS) : 0;
 }
 
-void Trainer::correct(char letter) {
+void Trainer::correct(char letter, int32_t latencyMs) {
     int idx = letter - FIRST_CHAR;
+    recordLatency(letter, latencyMs);
     if (idx >= 0 && idx < CHAR_COUNT && _charProb[idx] != 0 && !_plainText) {
-        if (_charProb[idx] <= 1 + DOWN_PROP) _charProb[idx] = 1;
-        else _charProb[idx] -= DOWN_PROP;
+        if (_charProb[idx] <= 1 + DOWN_PROP) setProb(idx, 1);
+        else setProb(idx, _charProb[idx] - DOWN_PROP);
     }
 
     TrainerEvent evt;
     evt.type = TrainerEvent::RESULT;
-    evt.correct = true;
-    evt.typedChar = letter;
-    evt.expectedChar = letter;
-    evt.prob = (idx >= 0 && idx < CHAR_COUNT) ? _charProb[idx] : 0;
+    evt.result.correct = true;
+    evt.result.typed = letter;
+    evt.result.expected = letter;
+    evt.result.prob = (idx >= 0 && idx < CHAR_COUNT) ? _charProb[idx] : 0;
+    evt.result.latencyMs = latencyMs;
+    evt.result.latencyAvgMs = getLatencyMs(letter);
     emitEvent(evt);
 }
 
-void Trainer::wrong(char typed, char expected) {
+void Trainer::wrong(char typed, char expected, int32_t latencyMs) {
     int h1 = typed - FIRST_CHAR;
     int h2 = expected - FIRST_CHAR;
 
+    recordLatency(expected, latencyMs);
+    _confusion.record(expected, typed);
+
     if (h1 >= 0 && h1 < CHAR_COUNT && _charProb[h1] != 0 && !_plainText) {
-        _charProb[h1] = min(100, _charProb[h1] + UP_PROP);
+        setProb(h1, min(100, _charProb[h1] + UP_PROP));
     }
-    if (h2 >= 0 && h2 < CHAR_COUNT && _charProb[h2] != 0 && !_plainText) {
-        _charProb[h2] = min(100, _charProb[h2] + UP_PROP);
+    if (h2 != h1 && h2 >= 0 && h2 < CHAR_COUNT && _charProb[h2] != 0 && !_plainText) {
+        setProb(h2, min(100, _charProb[h2] + UP_PROP));
     }
 
     _statErrors++;
 
     TrainerEvent evt;
     evt.type = TrainerEvent::RESULT;
-    evt.correct = false;
-    evt.typedChar = typed;
-    evt.expectedChar = expected;
-    evt.prob = (h1 >= 0 && h1 < CHAR_COUNT) ? _charProb[h1] : 0;
+    evt.result.correct = false;
+    evt.result.typed = typed;
+    evt.result.expected = expected;
+    evt.result.prob = (h1 >= 0 && h1 < CHAR_COUNT) ? _charProb[h1] : 0;
+    evt.result.latencyMs = latencyMs;
+    evt.result.latencyAvgMs = getLatencyMs(expected);
     emitEvent(evt);
 }
 
+// Time from the expected character finishing to this input, in ms.
+// Answering before it finished (it is still in the engine) counts as 0.
+int32_t Trainer::measureLatency() const {
+    if (queueDist() == 0) return 0;
+    uint32_t ms = (micros() - _queue.peek().doneUs) / 1000;
+    return ms > 0x7FFFFFFFUL ? 0x7FFFFFFF : (int32_t)ms;
+}
+
+void Trainer::recordLatency(char expected, int32_t latencyMs) {
+    if (latencyMs < 0) return;
+    // Cap so the Q(LATENCY_EWMA_SHIFT) value fits 16 bits
+    const int32_t capMs = 0xFFFF >> LATENCY_EWMA_SHIFT;
+    uint16_t ms = (uint16_t)(latencyMs > capMs ? capMs : latencyMs);
+
+    if (_winLatencyCount < STAT_LENGTH) _winLatency[_winLatencyCount++] = ms;
+
+    int idx = expected - FIRST_CHAR;
+    if (idx < 0 || idx >= CHAR_COUNT) return;
+    int32_t sample = (int32_t)ms << LATENCY_EWMA_SHIFT;
+    int32_t avg = _latencyEwma[idx];
+    // First sample seeds the average
+    _latencyEwma[idx] = avg == 0 ? sample : avg + ((sample - avg) >> LATENCY_EWMA_SHIFT);
+}
+
+// pct-th percentile of the window's latency samples (0 if none)
+uint16_t Trainer::windowLatency(uint8_t pct) const {
+    uint8_t n = _winLatencyCount;
+    if (n == 0) return 0;
+    uint16_t sorted[STAT_LENGTH];
+    for (uint8_t i = 0; i < n; i++) {
+        uint16_t v = _winLatency[i];
+        uint8_t j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+    }
+    uint8_t rank = (uint8_t)(((uint16_t)n * pct + 99) / 100);
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
 void Trainer::analyzeSpeed() {
-    if (_statErrors > 1) {
+    // Latency against the time one character takes at the effective
+    // speed (speed is characters per minute). A trainee who keeps up
+    // without errors but answers later and later is overloaded well
+    // before the queue distance triggers context lost.
+    uint32_t charPeriodMs = 60000UL / _speed;
+    bool lagging = _winLatencyCount > 0 &&
+                   (uint32_t)windowLatency(90) * 100 > charPeriodMs * LATENCY_SLOW_PCT;
+    bool hesitant = _winLatencyCount > 0 &&
+                    (uint32_t)windowLatency(50) * 100 > charPeriodMs * LATENCY_HOLD_PCT;
+
+    if (_statErrors > 1 || lagging) {
         _speed -= SPEED_DEC;
         if (_speed < MIN_SPEED) _speed = MIN_SPEED;
-        MorseEngine::setSpeed(_speed);
+        applySpeed();
 
         TrainerEvent evt;
         evt.type = TrainerEvent::SPEED_CHANGE;
-        evt.speed = _speed;
-        evt.direction = "down";
+        evt.state.speed = _speed;
+        evt.state.ditUs = currentDitUs();
+        evt.state.direction = "down";
         emitEvent(evt);
-    } else if (_statErrors == 0) {
+    } else if (_statErrors == 0 && !hesitant) {
         if (_speed < MAX_SPEED) _speed += SPEED_INC;
-        MorseEngine::setSpeed(_speed);
+        applySpeed();
 
         TrainerEvent evt;
         evt.type = TrainerEvent::SPEED_CHANGE;
-        evt.speed = _speed;
-        evt.direction = "up";
+        evt.state.speed = _speed;
+        evt.state.ditUs = currentDitUs();
+        evt.state.direction = "up";
         emitEvent(evt);
     }
     _statErrors = 0;
+    _winLatencyCount = 0;
 }
 
 void Trainer::contextLost() {
     _speed -= SPEED_DEC;
     if (_speed < MIN_SPEED) _speed = MIN_SPEED;
-    MorseEngine::setSpeed(_speed);
+    applySpeed();
 
     TrainerEvent evt;
     evt.type = TrainerEvent::CONTEXT_LOST;
-    evt.speed = _speed;
-    evt.direction = "down";
+    evt.state.speed = _speed;
+    evt.state.ditUs = currentDitUs();
+    evt.state.direction = "down";
     emitEvent(evt);
 
-    _statErrors = 0;
-    _lGroup = 0;
-    _queueIndexR = 0;
-    _queueIndexS = 0;
-    _statGroup = 0;
+    // Drop what's queued ahead and start over after the recovery spaces
+    MorseEngine::flush();
+    resetQueue();
 
     // Queue recovery spaces (drained non-blockingly by update())
     _recoverySpaces = 5;
 }
 
+void Trainer::resetQueue() {
+    // Blank slots so input before anything is queued compares to a space
+    const QueuedChar blank = { ' ', 0 };
+    for (uint16_t i = 0; i < SendQueue::capacity(); i++) _queue.at(i) = blank;
+    _queue.reset();
+    _sentSeq = 0;
+    _lGroup = 0;
+    _statErrors = 0;
+    _statGroup = 0;
+    _recoverySpaces = 0;
+    _recoveryInFlight = 0;
+    _winLatencyCount = 0;
+    _alignBase = 0;
+    _alignLen = 0;
+    _alignScored = 0;
+}
+
 void Trainer::loadProfile(int profile) {
-    if (profile == 0) {
-        // Load saved probabilities
-        if (!Storage::loadProbs(_charProb)) {
-            // Fallback to P1 if no saved data
-            const uint8_t* p = ::getProfile(1);
-            for (int i = 0; i < CHAR_COUNT; i++) {
-                _charProb[i] = pgm_read_byte(p + i);
-            }
+    // The preset (P0 falls back to P1), then whatever was learned on top
+    const uint8_t* p = ::getProfile(profile == 0 ? 1 : profile);
+    if (p) {
+        for (int i = 0; i < CHAR_COUNT; i++) {
+            _charProb[i] = pgm_read_byte(p + i);
         }
-    } else {
-        const uint8_t* p = ::getProfile(profile);
-        if (p) {
-            for (int i = 0; i < CHAR_COUNT; i++) {
-                _charProb[i] = pgm_read_byte(p + i);
-            }
-        }
-        // P2 enables plainText mode (probabilities stay constant)
-        _plainText = (profile == 2);
     }
+    Storage::loadProbs((uint8_t)profile, _charProb);
+    // P2 enables plainText mode (probabilities stay constant)
+    if (profile != 0) _plainText = (profile == 2);
+    _sampler.build(_charProb);
+}
+
+// Keep the sampler in step with every weight change
+void Trainer::setProb(int idx, uint8_t prob) {
+    _charProb[idx] = prob;
+    _sampler.set(idx, prob);
 }
 
 void Trainer::emitEvent(const TrainerEvent& evt) {
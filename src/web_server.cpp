@@ -3,84 +3,306 @@
 #include "storage.h"
 #include "morse_engine.h"
 #include "buzzer.h"
+#include "ws_protocol.h"
+#include "log_histogram.h"
+#include "event_log.h"
+#include "web_assets.h"
+#include "boot_timer.h"
+#include "metrics.h"
+#include "journal.h"
+#include "commands.h"
+#include "serial_interface.h"
 
 #include <ESP8266WiFi.h>
 #include <ESP8266mDNS.h>
 #include <ESPAsyncWebServer.h>
 #include <LittleFS.h>
 #include <ArduinoJson.h>
+#include <memory>
 
 static AsyncWebServer server(80);
 static AsyncWebSocket ws("/ws");
 
-static void handleWebSocketMessage(AsyncWebSocketClient* client, uint8_t* data, size_t len) {
-    // Reject oversized messages to protect heap
-    if (len > 256) return;
+// Connected clients and the event encoding each one negotiated
+struct WsPeer {
+    uint32_t id;
+    bool binary;
+    bool resync;         // owes a status snapshot (can't resume from the log)
+    uint32_t sentSeq;    // last logged event delivered
+    uint32_t replayNext; // catching up from the log from here (0 = live)
+    uint32_t dropped;    // events skipped for backpressure
+};
+static WsPeer peers[WS_MAX_PEERS];
+static uint8_t peerCount = 0;
 
-    // Parse JSON message
-    JsonDocument doc;
-    DeserializationError err = deserializeJson(doc, data, len);
-    if (err) return;
+// Event encoding cost per protocol (CPU ns per event, bytes per frame)
+struct WsEncodeStats {
+    uint32_t frames;
+    uint32_t events;
+    uint32_t bytes;
+    LogHistogram cpuNs;
+};
+static WsEncodeStats jsonStats;
+static WsEncodeStats binStats;
 
-    const char* type = doc["type"];
-    if (!type) return;
+// Events collected for the next broadcast: sent together once the
+// window has passed or the batch is full, one frame per client
+static TrainerEvent batch[WS_BATCH_MAX_EVENTS];
+static uint8_t batchLen = 0;
+static uint32_t batchStartMs = 0;
+static uint32_t batchCoalesced = 0;
 
-    if (strcmp(type, "key") == 0) {
-        const char* ch = doc["char"];
-        if (ch && ch[0]) {
-            char c = ch[0];
-            if (c > 96) c -= 32; // uppercase
-            trainer.processInput(c);
+// Broadcast events by sequence number, for clients resuming after a
+// dropped connection or a full send queue. bootId tells a client that
+// numbers it holds are from before a restart.
+static EventLog<TrainerEvent, WS_EVENT_LOG_LENGTH> eventLog;
+static uint32_t bootId = 0;
+static uint32_t replayedEvents = 0;
+static uint32_t snapshotsSent = 0;
+
+// WiFi bring-up, driven from update() so boot never waits on the radio
+enum WifiState : uint8_t {
+    NET_DOWN,
+    NET_STA_CONNECTING,
+    NET_STA_UP,
+    NET_AP_UP
+};
+static WifiState wifiStage = NET_DOWN;
+static uint32_t wifiStageMs = 0;  // millis() the current attempt began
+static uint32_t wifiStartUs = 0;  // micros() WiFi started, until it's up
+static bool staEverUp = false;    // connected once: never fall back to AP
+static bool mdnsStarted = false;
+
+static WsPeer* findPeer(uint32_t id) {
+    for (uint8_t i = 0; i < peerCount; i++) {
+        if (peers[i].id == id) return &peers[i];
+    }
+    return nullptr;
+}
+
+static void addPeer(uint32_t id) {
+    if (findPeer(id) || peerCount >= WS_MAX_PEERS) return;
+    peers[peerCount].id = id;
+    peers[peerCount].binary = false;
+    peers[peerCount].resync = false;
+    peers[peerCount].sentSeq = eventLog.lastSeq();
+    peers[peerCount].replayNext = 0;
+    peers[peerCount].dropped = 0;
+    peerCount++;
+}
+
+static void removePeer(uint32_t id) {
+    WsPeer* p = findPeer(id);
+    if (p) *p = peers[--peerCount];
+}
+
+static void recordEncode(WsEncodeStats& st, uint32_t startCcy, uint8_t events, size_t len) {
+    uint32_t ccy = ESP.getCycleCount() - startCcy;
+    st.cpuNs.record((uint32_t)((uint64_t)ccy * 1000 / clockCyclesPerMicrosecond() / events));
+    st.frames++;
+    st.events += events;
+    st.bytes += len;
+}
+
+static void encodeStatsJson(JsonObject o, const WsEncodeStats& st) {
+    o["frames"] = st.frames;
+    o["events"] = st.events;
+    o["bytes"] = st.bytes;
+    o["cpu_mean_ns"] = st.cpuNs.mean();
+    o["cpu_p99_ns"] = st.cpuNs.percentile(99);
+}
+
+static void statusJson(JsonDocument& resp) {
+    resp["type"] = "status";
+    resp["running"] = trainer.isRunning();
+    resp["speed"] = trainer.getSpeed();
+    resp["char_speed"] = trainer.getCharSpeed();
+    resp["profile"] = trainer.getProfile();
+    resp["drill"] = trainer.isDrill();
+    resp["lag_limit"] = trainer.getLagLimit();
+    resp["pitch"] = Buzzer::getFrequency();
+    resp["buzzerActive"] = Buzzer::isActive();
+    resp["boot"] = bootId;
+    resp["seq"] = eventLog.lastSeq();
+}
+
+// Bump allocator over a static buffer, for parsing WebSocket messages
+// without the heap. The document is gone by the next message, which
+// starts the buffer over; anything that doesn't fit goes to the heap.
+class ParseArena : public ArduinoJson::Allocator {
+public:
+    void* allocate(size_t size) override {
+        size = (size + 7) & ~(size_t)7;
+        if (size <= sizeof(_buf) - _used) {
+            _top = _used;
+            _used += size;
+            return _buf + _top;
         }
+        _heapAllocs++;
+        return malloc(size);
+    }
+
+    void deallocate(void* p) override {
+        if (!owns(p)) free(p);
+    }
+
+    void* reallocate(void* p, size_t size) override {
+        if (!owns(p)) return realloc(p, size);
+        size_t off = (uint8_t*)p - _buf;
+        size_t aligned = (size + 7) & ~(size_t)7;
+        if (off == _top && off + aligned <= sizeof(_buf)) {
+            _used = off + aligned;  // the last block grows or shrinks in place
+            return p;
+        }
+        size_t keep = _used - off < size ? _used - off : size;
+        void* q = allocate(size);
+        if (q) memmove(q, p, keep);
+        return q;
+    }
+
+    void reset() { _used = _top = 0; }
+    uint32_t heapAllocs() const { return _heapAllocs; }
+
+private:
+    bool owns(void* p) const { return p >= _buf && p < _buf + sizeof(_buf); }
+
+    alignas(8) uint8_t _buf[WS_PARSE_ARENA];
+    size_t _used = 0;
+    size_t _top = 0;
+    uint32_t _heapAllocs = 0;
+};
+static ParseArena parseArena;
+
+// A command message's fields as command arguments
+class JsonArgs : public Command::CommandArgs {
+public:
+    explicit JsonArgs(const JsonDocument& doc) : _doc(doc) {}
+
+    bool has(const char* key) const override { return !_doc[key].isNull(); }
+
+    bool getInt(const char* key, int& out) const override {
+        JsonVariantConst v = _doc[key];
+        if (!v.is<int>()) return false;
+        out = v.as<int>();
+        return true;
+    }
+
+    bool getBool(const char* key, bool& out) const override {
+        JsonVariantConst v = _doc[key];
+        if (v.is<bool>()) out = v.as<bool>();
+        else if (v.is<int>()) out = v.as<int>() != 0;
+        else return false;
+        return true;
+    }
+
+    const char* getStr(const char* key) const override {
+        return _doc[key].as<const char*>();
     }
-    else if (strcmp(type, "command") == 0) {
-        const char* cmd = doc["cmd"];
-        if (!cmd) return;
 
-        if (strcmp(cmd, "start") == 0) {
-            int profile = doc["profile"] | DEFAULT_PROFILE;
-            int speed = doc["speed"] | DEFAULT_SPEED;
-            trainer.start(profile, speed);
+private:
+    const JsonDocument& _doc;
+};
+
+// Reply to a command that reports something. The others are answered
+// by the events they cause.
+static void sendReport(AsyncWebSocketClient* client, Command::Id id, const JsonDocument& doc) {
+    JsonDocument resp;
+    switch (id) {
+        case Command::EVENTS: {
+            resp["type"] = "events";
+            JsonArray sinks = resp["sinks"].to<JsonArray>();
+            for (uint8_t i = 0; i < eventBus.sinkCount(); i++) {
+                TrainerEventBus::Stats st = eventBus.stats(i);
+                JsonObject o = sinks.add<JsonObject>();
+                o["name"] = eventBus.sinkName(i);
+                o["depth"] = st.depth;
+                o["max_depth"] = st.maxDepth;
+                o["delivered"] = st.delivered;
+                o["dropped"] = st.dropped;
+                o["coalesced"] = st.coalesced;
+            }
+            break;
         }
-        else if (strcmp(cmd, "stop") == 0) {
-            trainer.stop();
+        case Command::WS_STATS: {
+            // Event encoding cost per protocol, plus heap state
+            bool reset;
+            if (JsonArgs(doc).getBool("reset", reset) && reset) {
+                jsonStats = WsEncodeStats();
+                binStats = WsEncodeStats();
+                batchCoalesced = 0;
+                replayedEvents = 0;
+                snapshotsSent = 0;
+                for (uint8_t i = 0; i < peerCount; i++) peers[i].dropped = 0;
+            }
+            uint8_t nBin = 0;
+            uint32_t dropped = 0;
+            for (uint8_t i = 0; i < peerCount; i++) {
+                nBin += peers[i].binary;
+                dropped += peers[i].dropped;
+            }
+
+            resp["type"] = "ws_stats";
+            resp["clients"] = peerCount;
+            resp["binary_clients"] = nBin;
+            encodeStatsJson(resp["json"].to<JsonObject>(), jsonStats);
+            encodeStatsJson(resp["bin"].to<JsonObject>(), binStats);
+            resp["coalesced"] = batchCoalesced;
+            resp["dropped"] = dropped;
+            resp["replayed"] = replayedEvents;
+            resp["snapshots"] = snapshotsSent;
+            resp["log_seq"] = eventLog.lastSeq();
+            resp["log_size"] = eventLog.size();
+            resp["parse_heap_allocs"] = parseArena.heapAllocs();
+            resp["heap_free"] = ESP.getFreeHeap();
+            resp["heap_max_block"] = ESP.getMaxFreeBlockSize();
+            resp["heap_frag_pct"] = ESP.getHeapFragmentation();
+            break;
         }
-        else if (strcmp(cmd, "speed") == 0) {
-            int speed = doc["speed"] | trainer.getSpeed();
-            trainer.setSpeed(speed);
+        case Command::CONFUSION: {
+            resp["type"] = "confusion";
+            resp["drill"] = trainer.isDrill();
+            resp["tracked"] = trainer.getConfusion().size();
+            JsonArray pairs = resp["pairs"].to<JsonArray>();
+            ConfusionMatrix::Entry top[10];
+            uint8_t n = trainer.getConfusion().top(top, 10);
+            for (uint8_t i = 0; i < n; i++) {
+                JsonObject p = pairs.add<JsonObject>();
+                p["expected"] = String(top[i].expected);
+                p["typed"] = String(top[i].typed);
+                p["count"] = top[i].count;
+            }
+            break;
         }
-        else if (strcmp(cmd, "pitch") == 0) {
-            int freq = doc["freq"] | Buzzer::getFrequency();
-            if (freq >= 300 && freq <= 1200) {
-                Buzzer::setFrequency(freq);
+        case Command::CLOCK:
+            // Clock probe: the client times the round trip and maps device
+            // micros() (char_start timestamps) onto its own clock
+            resp["type"] = "clock";
+            resp["t"] = doc["t"];
+            resp["us"] = micros();
+            break;
+        case Command::STATUS:
+            statusJson(resp);
+            break;
+        case Command::TIMING: {
+            // Transmit edge timing histogram
+            const LogHistogram& h = MorseEngine::edgeTiming();
+            resp["type"] = "timing";
+            resp["edges"] = h.count();
+            resp["dropped"] = MorseEngine::edgeTimingDropped();
+            resp["mean_ns"] = h.mean();
+            resp["p50_ns"] = h.percentile(50);
+            resp["p99_ns"] = h.percentile(99);
+            resp["max_ns"] = h.max();
+            JsonArray arr = resp["buckets"].to<JsonArray>();
+            for (uint8_t i = 0; i < LogHistogram::BUCKETS; i++) {
+                if (h.bucketCount(i) == 0) continue;
+                JsonObject entry = arr.add<JsonObject>();
+                entry["le_ns"] = LogHistogram::bucketUpper(i);
+                entry["count"] = h.bucketCount(i);
             }
+            break;
         }
-        else if (strcmp(cmd, "buzzer_type") == 0) {
-            bool active = doc["active"] | true;
-            Buzzer::setActive(active);
-            // Persist
-            Storage::Config cfg;
-            Storage::loadConfig(cfg);
-            cfg.buzzerActive = active;
-            Storage::saveConfig(cfg);
-        }
-        else if (strcmp(cmd, "status") == 0) {
-            // Send status response
-            JsonDocument resp;
-            resp["type"] = "status";
-            resp["running"] = trainer.isRunning();
-            resp["speed"] = trainer.getSpeed();
-            resp["profile"] = trainer.getProfile();
-            resp["pitch"] = Buzzer::getFrequency();
-            resp["buzzerActive"] = Buzzer::isActive();
-
-            String out;
-            serializeJson(resp, out);
-            client->text(out);
-        }
-        else if (strcmp(cmd, "probs") == 0) {
-            // Send probabilities
-            JsonDocument resp;
+        case Command::PROBS: {
             resp["type"] = "probs";
             JsonArray arr = resp["data"].to<JsonArray>();
             const uint8_t* probs = trainer.getProbs();
@@ -92,10 +314,76 @@ static void handleWebSocketMessage(AsyncWebSocketClient* client, uint8_t* data,
                     entry["prob"] = probs[i];
                 }
             }
-            String out;
-            serializeJson(resp, out);
-            client->text(out);
+            break;
         }
+        default:
+            return;
+    }
+    String out;
+    serializeJson(resp, out);
+    client->text(out);
+}
+
+static void handleWebSocketMessage(AsyncWebSocketClient* client, uint8_t* data, size_t len) {
+    // Reject oversized messages to protect heap
+    if (len > WS_MSG_MAX) return;
+
+    // Parse JSON message
+    parseArena.reset();
+    JsonDocument doc(&parseArena);
+    DeserializationError err = deserializeJson(doc, data, len);
+    if (err) return;
+
+    const char* type = doc["type"];
+    if (!type) return;
+
+    if (strcmp(type, "hello") == 0) {
+        // Protocol negotiation: binary events if the client speaks our version
+        const char* proto = doc["proto"] | "json";
+        int version = doc["version"] | 0;
+        bool binary = strcmp(proto, "bin") == 0 && version == WsProtocol::VERSION;
+        WsPeer* peer = findPeer(client->id());
+        if (peer) peer->binary = binary;
+
+        // Resume where the client left off if the log still reaches back
+        // that far; otherwise (or if it's new) send it a snapshot
+        const char* resume = "snapshot";
+        uint32_t seq = doc["seq"].as<uint32_t>();
+        if (peer && doc["seq"].is<uint32_t>() && doc["boot"].as<uint32_t>() == bootId &&
+            eventLog.canResumeAfter(seq)) {
+            peer->sentSeq = seq;
+            peer->replayNext = seq < eventLog.lastSeq() ? seq + 1 : 0;
+            resume = peer->replayNext ? "replay" : "live";
+        } else if (peer) {
+            peer->replayNext = 0;
+            peer->resync = true;
+        }
+
+        JsonDocument resp;
+        resp["type"] = "hello";
+        resp["proto"] = (peer && binary) ? "bin" : "json";
+        resp["version"] = WsProtocol::VERSION;
+        resp["boot"] = bootId;
+        resp["seq"] = eventLog.lastSeq();
+        resp["resume"] = resume;
+        String out;
+        serializeJson(resp, out);
+        client->text(out);
+    }
+    else if (strcmp(type, "key") == 0) {
+        const char* ch = doc["char"];
+        if (ch && ch[0]) {
+            char c = ch[0];
+            if (c > 96) c -= 32; // uppercase
+            trainer.processInput(c);
+        }
+    }
+    else if (strcmp(type, "command") == 0) {
+        const char* cmd = doc["cmd"];
+        if (!cmd) return;
+        const Command::Entry* e = Command::find(cmd);
+        if (!e || !(e->via & Command::VIA_WS)) return;
+        if (Command::run(e->id, JsonArgs(doc)) != Command::INVALID) sendReport(client, e->id, doc);
     }
 }
 
@@ -103,13 +391,15 @@ static void onWsEvent(AsyncWebSocket* server, AsyncWebSocketClient* client,
                        AwsEventType type, void* arg, uint8_t* data, size_t len) {
     switch (type) {
         case WS_EVT_CONNECT:
-            Serial.printf("[WS] Client #%u connected from %s (heap: %u, clients: %u)\n",
-                          client->id(), client->remoteIP().toString().c_str(),
-                          ESP.getFreeHeap(), ws.count());
+            SerialInterface::log("[WS] Client #%u connected from %s (heap: %u, clients: %u)\n",
+                                 client->id(), client->remoteIP().toString().c_str(),
+                                 ESP.getFreeHeap(), (unsigned)ws.count());
+            addPeer(client->id());
             break;
         case WS_EVT_DISCONNECT:
-            Serial.printf("[WS] Client #%u disconnected (heap: %u)\n",
-                          client->id(), ESP.getFreeHeap());
+            SerialInterface::log("[WS] Client #%u disconnected (heap: %u)\n",
+                                 client->id(), ESP.getFreeHeap());
+            removePeer(client->id());
             break;
         case WS_EVT_DATA: {
             AwsFrameInfo* info = (AwsFrameInfo*)arg;
@@ -124,56 +414,336 @@ static void onWsEvent(AsyncWebSocket* server, AsyncWebSocketClient* client,
     }
 }
 
-static void broadcastJson(JsonDocument& doc) {
-    String out;
+// One event as a JSON object (the pre-batching message format)
+static void eventJson(JsonObject o, const TrainerEvent& evt) {
+    char pattern[MORSE_MAX_ELEMENTS + 1];
+    char ch[2] = { 0, 0 };
+    char expected[2] = { 0, 0 };
+
+    switch (evt.type) {
+        case TrainerEvent::CHAR_SENT:
+            morseCodeToString(evt.sent.code, pattern);
+            ch[0] = evt.sent.ch;
+            o["type"] = "char_sent";
+            o["char"] = ch;
+            o["pattern"] = pattern;
+            o["queue_dist"] = evt.sent.queueDist;
+            o["duration_us"] = evt.sent.durationUs;
+            break;
+
+        case TrainerEvent::RESULT:
+            ch[0] = evt.result.typed;
+            expected[0] = evt.result.expected;
+            o["type"] = "result";
+            o["correct"] = evt.result.correct;
+            o["typed"] = ch;
+            o["expected"] = expected;
+            o["prob"] = evt.result.prob;
+            if (evt.result.latencyMs >= 0) o["latency_ms"] = evt.result.latencyMs;
+            o["latency_avg_ms"] = evt.result.latencyAvgMs;
+            break;
+
+        case TrainerEvent::SPEED_CHANGE:
+            o["type"] = "speed_change";
+            o["speed"] = evt.state.speed;
+            o["dit_us"] = evt.state.ditUs;
+            o["direction"] = evt.state.direction;
+            break;
+
+        case TrainerEvent::SESSION_STATE:
+            o["type"] = "session";
+            o["state"] = evt.state.running ? "started" : "stopped";
+            o["speed"] = evt.state.speed;
+            o["dit_us"] = evt.state.ditUs;
+            o["char_speed"] = evt.state.charSpeed;
+            break;
+
+        case TrainerEvent::CONTEXT_LOST:
+            o["type"] = "context_lost";
+            o["speed"] = evt.state.speed;
+            o["dit_us"] = evt.state.ditUs;
+            break;
+
+        case TrainerEvent::CHAR_START:
+            morseCodeToString(evt.tone.code, pattern);
+            ch[0] = evt.tone.ch;
+            o["type"] = "char_start";
+            o["char"] = ch;
+            o["pattern"] = pattern;
+            o["start_us"] = evt.tone.startUs;
+            o["dit_us"] = evt.tone.ditUs;
+            o["gap_us"] = evt.tone.gapUs;
+            break;
+    }
+}
+
+// Events as one binary frame: records back to back, closed by a SEQ
+// record when lastSeq (the number of the last logged one) is set
+static size_t encodeBin(const TrainerEvent* evts, uint8_t n, uint32_t lastSeq, uint8_t* out) {
+    uint32_t t0 = ESP.getCycleCount();
+    size_t len = 0;
+    for (uint8_t i = 0; i < n; i++) len += WsProtocol::encode(evts[i], out + len);
+    if (lastSeq) len += WsProtocol::encodeSeq(lastSeq, out + len);
+    recordEncode(binStats, t0, n, len);
+    return len;
+}
+
+// JSON: a single event stays a plain object, a batch is an array.
+// seqs[i] = 0 for events that are not logged.
+static void encodeJson(const TrainerEvent* evts, const uint32_t* seqs, uint8_t n, String& out) {
+    uint32_t t0 = ESP.getCycleCount();
+    JsonDocument doc;
+    if (n == 1) {
+        JsonObject o = doc.to<JsonObject>();
+        eventJson(o, evts[0]);
+        if (seqs[0]) o["seq"] = seqs[0];
+    } else {
+        JsonArray arr = doc.to<JsonArray>();
+        for (uint8_t i = 0; i < n; i++) {
+            JsonObject o = arr.add<JsonObject>();
+            eventJson(o, evts[i]);
+            if (seqs[i]) o["seq"] = seqs[i];
+        }
+    }
     serializeJson(doc, out);
-    ws.textAll(out);
+    recordEncode(jsonStats, t0, n, out.length());
 }
 
-void WebServer::begin() {
-    // Load WiFi config
-    Storage::Config cfg;
-    Storage::loadConfig(cfg);
+static const size_t WS_FRAME_MAX = WS_BATCH_MAX_EVENTS * WsProtocol::MAX_FRAME + WsProtocol::SEQ_LEN;
 
-    if (cfg.wifiMode == "sta" && cfg.staSSID.length() > 0) {
-        // Station mode
-        WiFi.mode(WIFI_STA);
-        WiFi.begin(cfg.staSSID.c_str(), cfg.staPass.c_str());
-        Serial.print(F("Connecting to WiFi: ")); Serial.println(cfg.staSSID);
+// Send the batch: logged, then encoded once per protocol in use, one
+// frame per client. A client whose send queue is full skips the batch
+// rather than growing the heap; once it drains, update() replays what
+// it missed from the log.
+static void flushBatch() {
+    uint8_t n = batchLen;
+    batchLen = 0;
+    if (n == 0) return;
 
-        unsigned long start = millis();
-        while (WiFi.status() != WL_CONNECTED && millis() - start < 15000) {
-            delay(500);
-            Serial.print(".");
+    // Number everything but the sidetone timelines, which are only
+    // worth anything live
+    uint32_t seqs[WS_BATCH_MAX_EVENTS];
+    uint32_t lastSeq = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        seqs[i] = batch[i].type == TrainerEvent::CHAR_START ? 0 : eventLog.append(batch[i]);
+        if (seqs[i]) lastSeq = seqs[i];
+    }
+
+    uint8_t nBin = 0;
+    uint8_t nLive = 0;
+    for (uint8_t i = 0; i < peerCount; i++) {
+        if (peers[i].replayNext || peers[i].resync) continue;
+        nLive++;
+        nBin += peers[i].binary;
+    }
+    if (nLive == 0) return;
+
+    uint8_t bin[WS_FRAME_MAX];
+    size_t binLen = nBin > 0 ? encodeBin(batch, n, lastSeq, bin) : 0;
+    String json;
+    if (nBin < nLive) encodeJson(batch, seqs, n, json);
+
+    for (uint8_t i = 0; i < peerCount; i++) {
+        WsPeer& p = peers[i];
+        if (p.replayNext || p.resync) continue;  // update() catches it up
+        AsyncWebSocketClient* c = ws.client(p.id);
+        if (!c) continue;
+        if (c->queueIsFull()) {
+            p.dropped += n;
+            if (lastSeq) p.replayNext = p.sentSeq + 1;
+            continue;
+        }
+        if (p.binary) {
+            c->binary(bin, binLen);
+        } else {
+            c->text(json);
         }
+        if (lastSeq) p.sentSeq = lastSeq;
+    }
+}
 
-        if (WiFi.status() == WL_CONNECTED) {
-            Serial.println();
-            Serial.print(F("Connected! IP: ")); Serial.println(WiFi.localIP());
+// Catch a client up: replay from the log a frame at a time while its
+// send queue has room, or send a status snapshot if the log has moved
+// past the point it needs
+static void servePeer(WsPeer& p, AsyncWebSocketClient* c) {
+    while (p.replayNext && !c->queueIsFull()) {
+        uint32_t last = eventLog.lastSeq();
+        if (p.replayNext > last) {
+            p.replayNext = 0;
+            break;
+        }
+        if (!eventLog.contains(p.replayNext)) {
+            p.replayNext = 0;
+            p.resync = true;
+            break;
+        }
+
+        TrainerEvent evts[WS_BATCH_MAX_EVENTS];
+        uint32_t seqs[WS_BATCH_MAX_EVENTS];
+        uint8_t n = 0;
+        while (n < WS_BATCH_MAX_EVENTS && p.replayNext + n <= last) {
+            seqs[n] = p.replayNext + n;
+            evts[n] = eventLog.get(seqs[n]);
+            n++;
+        }
+        if (p.binary) {
+            uint8_t bin[WS_FRAME_MAX];
+            c->binary(bin, encodeBin(evts, n, seqs[n - 1], bin));
         } else {
-            Serial.println(F("\nSTA failed, falling back to AP mode"));
-            WiFi.mode(WIFI_AP);
-            WiFi.softAP(AP_SSID, AP_PASS);
-            Serial.print(F("AP IP: ")); Serial.println(WiFi.softAPIP());
+            String json;
+            encodeJson(evts, seqs, n, json);
+            c->text(json);
         }
-    } else {
-        // AP mode (default)
-        WiFi.mode(WIFI_AP);
-        WiFi.softAP(AP_SSID, AP_PASS);
-        Serial.print(F("AP Mode - SSID: ")); Serial.println(AP_SSID);
-        Serial.print(F("AP IP: ")); Serial.println(WiFi.softAPIP());
+        p.sentSeq = seqs[n - 1];
+        p.replayNext = p.sentSeq + 1;
+        replayedEvents += n;
+    }
+
+    if (p.resync && !c->queueIsFull()) {
+        JsonDocument doc;
+        statusJson(doc);
+        String status;
+        serializeJson(doc, status);
+        c->text(status);
+        p.sentSeq = eventLog.lastSeq();
+        p.resync = false;
+        snapshotsSent++;
     }
+}
+
+// Embedded UI asset: gzipped from flash, revalidated by ETag. Assets
+// whose URL carries a content hash may be cached for good; index.html
+// must be revalidated so a new build is picked up on the next load.
+static void serveAsset(AsyncWebServerRequest* request, const WebAssets::Asset& a) {
+    const char* cache = a.immutable ? "public, max-age=31536000, immutable"
+                                    : "no-cache";
+    AsyncWebHeader* inm = request->getHeader("If-None-Match");
+    if (inm && inm->value().indexOf(a.etag) >= 0) {
+        AsyncWebServerResponse* res = request->beginResponse(304);
+        res->addHeader("ETag", a.etag);
+        res->addHeader("Cache-Control", cache);
+        request->send(res);
+        return;
+    }
+    AsyncWebServerResponse* res = request->beginResponse_P(200, a.type, a.gz, a.len);
+    res->addHeader("Content-Encoding", "gzip");
+    res->addHeader("ETag", a.etag);
+    res->addHeader("Cache-Control", cache);
+    request->send(res);
+}
+
+// Start the soft AP (config'd AP mode, or STA fallback)
+static void startAp() {
+    WiFi.mode(WIFI_AP);
+    WiFi.softAP(AP_SSID, AP_PASS);
+    wifiStage = NET_AP_UP;
+    Serial.print(F("AP Mode - SSID: ")); Serial.println(AP_SSID);
+    Serial.print(F("AP IP: ")); Serial.println(WiFi.softAPIP());
+}
 
-    // mDNS
-    if (MDNS.begin(MDNS_HOST)) {
+// WiFi is up: mDNS (once) and the boot report's wifi phase
+static void onWifiUp() {
+    if (!mdnsStarted && MDNS.begin(MDNS_HOST)) {
+        mdnsStarted = true;
         Serial.print(F("mDNS: http://")); Serial.print(MDNS_HOST); Serial.println(F(".local"));
     }
+    if (wifiStartUs) {
+        uint32_t now = micros();
+        bootTimer.markSince("wifi", wifiStartUs, now);
+        Serial.print(F("[BOOT] wifi up after ")); Serial.print((now - wifiStartUs) / 1000);
+        Serial.println(F(" ms"));
+        wifiStartUs = 0;
+    }
+}
+
+// STA connect and AP fallback, one step per loop() pass
+static void updateWifi() {
+    switch (wifiStage) {
+        case NET_STA_CONNECTING:
+            if (WiFi.status() == WL_CONNECTED) {
+                wifiStage = NET_STA_UP;
+                staEverUp = true;
+                Serial.print(F("Connected! IP: ")); Serial.println(WiFi.localIP());
+                onWifiUp();
+            } else if (!staEverUp && millis() - wifiStageMs >= STA_CONNECT_TIMEOUT_MS) {
+                Serial.println(F("STA failed, falling back to AP mode"));
+                startAp();
+                onWifiUp();
+            }
+            break;
+
+        case NET_STA_UP:
+            // The SDK reconnects by itself; just follow along
+            if (WiFi.status() != WL_CONNECTED) {
+                wifiStage = NET_STA_CONNECTING;
+                wifiStageMs = millis();
+                Serial.println(F("WiFi connection lost, reconnecting"));
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+void WebServer::begin(const Storage::Config& cfg) {
+    bootId = ESP.random();
+
+    // WiFi comes up from update(): nothing here waits on the radio
+    wifiStartUs = micros();
+    if (strcmp(cfg.wifiMode, "sta") == 0 && cfg.staSSID[0]) {
+        WiFi.mode(WIFI_STA);
+        WiFi.begin(cfg.staSSID, cfg.staPass);
+        wifiStage = NET_STA_CONNECTING;
+        wifiStageMs = millis();
+        Serial.print(F("Connecting to WiFi: ")); Serial.println(cfg.staSSID);
+    } else {
+        startAp();
+        onWifiUp();
+    }
 
     // WebSocket
     ws.onEvent(onWsEvent);
     server.addHandler(&ws);
 
-    // Serve static files from LittleFS — no browser caching
+    // Web UI from flash (include/web_assets.h); "/" is index.html
+    for (uint8_t i = 0; i < WebAssets::ASSET_COUNT; i++) {
+        const WebAssets::Asset& a = WebAssets::ASSETS[i];
+        server.on(a.path, HTTP_GET, [&a](AsyncWebServerRequest* request) {
+            serveAsset(request, a);
+        });
+        if (strcmp(a.path, "/index.html") == 0) {
+            server.on("/", HTTP_GET, [&a](AsyncWebServerRequest* request) {
+                serveAsset(request, a);
+            });
+        }
+    }
+
+    // Runtime metrics for a Prometheus scraper (metrics.h)
+    server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest* request) {
+        AsyncResponseStream* res = request->beginResponseStream("text/plain; version=0.0.4");
+        metrics.render(*res);
+        request->send(res);
+    });
+
+    // Session journal as CSV, streamed from flash
+    server.on("/journal.csv", HTTP_GET, [](AsyncWebServerRequest* request) {
+        std::shared_ptr<Journal::Export> exp(new Journal::Export());
+        AsyncWebServerResponse* res = request->beginChunkedResponse("text/csv",
+            [exp](uint8_t* buf, size_t maxLen, size_t) -> size_t {
+                return exp->read(buf, maxLen);
+            });
+        res->addHeader("Content-Disposition", "attachment; filename=\"journal.csv\"");
+        request->send(res);
+    });
+    server.on("/journal_totals.csv", HTTP_GET, [](AsyncWebServerRequest* request) {
+        AsyncResponseStream* res = request->beginResponseStream("text/csv");
+        res->addHeader("Content-Disposition", "attachment; filename=\"journal_totals.csv\"");
+        Journal::writeTotalsCsv(*res);
+        request->send(res);
+    });
+
+    // Anything else uploaded to LittleFS — no browser caching
     server.serveStatic("/", LittleFS, "/")
         .setDefaultFile("index.html")
         .setCacheControl("no-cache, no-store, must-revalidate");
@@ -183,46 +753,64 @@ void WebServer::begin() {
 }
 
 void WebServer::update() {
-    ws.cleanupClients(4);
-    MDNS.update();
+    updateWifi();
+    if (batchLen > 0 && millis() - batchStartMs >= WS_BATCH_WINDOW_MS) flushBatch();
+    for (uint8_t i = 0; i < peerCount; i++) {
+        WsPeer& p = peers[i];
+        if (!p.replayNext && !p.resync) continue;
+        AsyncWebSocketClient* c = ws.client(p.id);
+        if (c) servePeer(p, c);
+    }
+    ws.cleanupClients(WS_MAX_CLIENTS);
+    if (mdnsStarted) MDNS.update();
 }
 
-void WebServer::onTrainerEvent(const TrainerEvent& evt) {
-    JsonDocument doc;
+const char* WebServer::wifiState() {
+    switch (wifiStage) {
+        case NET_STA_CONNECTING: return "connecting";
+        case NET_STA_UP:         return "sta";
+        case NET_AP_UP:          return "ap";
+        default:                  return "off";
+    }
+}
 
-    switch (evt.type) {
-        case TrainerEvent::CHAR_SENT:
-            doc["type"] = "char_sent";
-            doc["char"] = String(evt.sentChar);
-            doc["pattern"] = evt.pattern;
-            doc["queue_dist"] = evt.queueDist;
-            break;
+IPAddress WebServer::ipAddress() {
+    if (wifiStage == NET_AP_UP) return WiFi.softAPIP();
+    return WiFi.localIP();
+}
 
-        case TrainerEvent::RESULT:
-            doc["type"] = "result";
-            doc["correct"] = evt.correct;
-            doc["typed"] = String(evt.typedChar);
-            doc["expected"] = String(evt.expectedChar);
-            doc["prob"] = evt.prob;
-            break;
+uint8_t WebServer::clientCount() {
+    return peerCount;
+}
 
-        case TrainerEvent::SPEED_CHANGE:
-            doc["type"] = "speed_change";
-            doc["speed"] = evt.speed;
-            doc["direction"] = evt.direction;
-            break;
+uint32_t WebServer::queueDepth() {
+    uint32_t n = 0;
+    for (uint8_t i = 0; i < peerCount; i++) {
+        AsyncWebSocketClient* c = ws.client(peers[i].id);
+        if (c) n += c->queueLen();
+    }
+    return n;
+}
 
-        case TrainerEvent::SESSION_STATE:
-            doc["type"] = "session";
-            doc["state"] = evt.running ? "started" : "stopped";
-            doc["speed"] = evt.speed;
-            break;
+void WebServer::onTrainerEvent(const TrainerEvent& evt) {
+    // Batched (and so logged) even with no clients connected: a phone
+    // that dropped off the AP replays what happened while it was away
+    if (batchLen == 0) batchStartMs = millis();
 
-        case TrainerEvent::CONTEXT_LOST:
-            doc["type"] = "context_lost";
-            doc["speed"] = evt.speed;
-            break;
+    // A newer speed supersedes one still waiting in the window. It goes
+    // last: events queued after the old one carry their own speed, and
+    // clients apply them in order, so it can't take the old one's place.
+    if (evt.type == TrainerEvent::SPEED_CHANGE) {
+        for (uint8_t i = 0; i < batchLen; i++) {
+            if (batch[i].type == TrainerEvent::SPEED_CHANGE) {
+                memmove(&batch[i], &batch[i + 1], (batchLen - i - 1) * sizeof(batch[0]));
+                batchLen--;
+                batchCoalesced++;
+                break;  // never more than one waiting
+            }
+        }
     }
 
-    broadcastJson(doc);
+    batch[batchLen++] = evt;
+    if (batchLen >= WS_BATCH_MAX_EVENTS) flushBatch();
 }
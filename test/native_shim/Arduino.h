@@ -13,6 +13,9 @@
 // PROGMEM is a no-op on native — data is already in RAM
 #define PROGMEM
 
+// No instruction RAM placement on native
+#define IRAM_ATTR
+
 // Flash-read macros just dereference the pointer
 #define pgm_read_byte(addr) (*(const uint8_t*)(addr))
 #define pgm_read_ptr(addr)  (*(const void* const*)(addr))
@@ -0,0 +1,93 @@
+/**
+ * File-backed FS shim for native (desktop) unit testing.
+ * Maps the ESP8266 FS/File API onto stdio files under a root directory,
+ * counts bytes and operations, and can simulate a power cut part way
+ * through a write.
+ */
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class File {
+public:
+    File() {}
+    File(std::shared_ptr<FILE> f, uint64_t* written, uint64_t* read, int64_t* budget)
+        : _f(f), _written(written), _read(read), _budget(budget) {}
+
+    explicit operator bool() const { return (bool)_f; }
+
+    size_t write(const uint8_t* buf, size_t len) {
+        if (!_f) return 0;
+        size_t n = len;
+        if (*_budget >= 0 && (int64_t)n > *_budget) n = (size_t)*_budget;  // power cut
+        n = fwrite(buf, 1, n, _f.get());
+        if (*_budget >= 0) *_budget -= (int64_t)n;
+        *_written += n;
+        return n;
+    }
+
+    size_t read(uint8_t* buf, size_t len) {
+        if (!_f) return 0;
+        size_t n = fread(buf, 1, len, _f.get());
+        *_read += n;
+        return n;
+    }
+
+    size_t size() const {
+        if (!_f) return 0;
+        long pos = ftell(_f.get());
+        fseek(_f.get(), 0, SEEK_END);
+        long end = ftell(_f.get());
+        fseek(_f.get(), pos, SEEK_SET);
+        return (size_t)end;
+    }
+
+    bool seek(uint32_t pos) { return _f && fseek(_f.get(), (long)pos, SEEK_SET) == 0; }
+
+    void close() { _f.reset(); }
+
+private:
+    std::shared_ptr<FILE> _f;
+    uint64_t* _written = nullptr;
+    uint64_t* _read = nullptr;
+    int64_t* _budget = nullptr;
+};
+
+class FS {
+public:
+    explicit FS(const std::string& root) : _root(root) {}
+
+    File open(const char* path, const char* mode) {
+        std::string m = mode[0] == 'w' ? "wb" : mode[0] == 'a' ? "ab" : "rb";
+        FILE* f = fopen((_root + path).c_str(), m.c_str());
+        if (!f) return File();
+        opens++;
+        return File(std::shared_ptr<FILE>(f, fclose), &bytesWritten, &bytesRead, &writeBudget);
+    }
+
+    bool exists(const char* path) {
+        FILE* f = fopen((_root + path).c_str(), "rb");
+        if (f) fclose(f);
+        return f != nullptr;
+    }
+
+    bool remove(const char* path) { return ::remove((_root + path).c_str()) == 0; }
+
+    bool rename(const char* from, const char* to) {
+        return ::rename((_root + from).c_str(), (_root + to).c_str()) == 0;
+    }
+
+    // Counters, reset freely by tests
+    uint64_t bytesWritten = 0;
+    uint64_t bytesRead = 0;
+    uint32_t opens = 0;
+
+    // Bytes that reach the file before "power fails" (-1 = never)
+    int64_t writeBudget = -1;
+
+private:
+    std::string _root;
+};
@@ -1,6 +1,27 @@
 #include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <filesystem>
 #include "morse_table.h"
 #include "profiles.h"
+#include "log_histogram.h"
+#include "morse_timing.h"
+#include "weighted_sampler.h"
+#include "fast_rng.h"
+#include "confusion_matrix.h"
+#include "input_aligner.h"
+#include "ring_buffer.h"
+#include "event_bus.h"
+#include "event_log.h"
+#include "boot_timer.h"
+#include "metrics.h"
+#include "write_behind.h"
+#include "journal.h"
+#include "prob_store.h"
+#include "command_table.h"
+#include "log_buffer.h"
+#include "ws_protocol.h"
 
 // ==========================================
 // Morse Encode/Decode Round-Trip Tests
@@ -147,6 +168,193 @@ void test_decode_dot_dash(void) {
     TEST_ASSERT_EQUAL_CHAR('A', morseDecode(".-"));
 }
 
+// ==========================================
+// Packed Code Tables
+// ==========================================
+
+// Reference copy of the original linear-scan encoder, kept to prove the
+// generated tables are equivalent and to benchmark against.
+static int legacyEncode(char ch, char* buf) {
+    if (ch > 96) ch -= 32;
+    int i;
+    for (i = 0; i < morseTableLength; i++) {
+        if (pgm_read_byte(morseTable + i) == ch) break;
+    }
+    if (i >= morseTableLength) {
+        buf[0] = '\0';
+        return 0;
+    }
+    int morseTablePos = i + 1;
+    int test;
+    int startLevel;
+    for (startLevel = 0; startLevel < morseTreeLevels; startLevel++) {
+        test = (morseTablePos + (1 << startLevel)) % (2 << startLevel);
+        if (test == 0) break;
+    }
+    int numSignals = morseTreeLevels - startLevel;
+    if (numSignals <= 0) {
+        buf[0] = ' ';
+        buf[1] = '\0';
+        return 1;
+    }
+    int pos = 0;
+    int tPos = morseTablePos;
+    for (int j = startLevel; j < morseTreeLevels; j++) {
+        int add = (1 << j);
+        test = (tPos + add) / (2 << j);
+        if (test & 1) {
+            tPos += add;
+            buf[numSignals - 1 - pos++] = '.';
+        } else {
+            tPos -= add;
+            buf[numSignals - 1 - pos++] = '-';
+        }
+    }
+    buf[pos] = '\0';
+    return numSignals;
+}
+
+static char legacyDecode(const char* pattern) {
+    int pos = morseTreetop;
+    for (int i = 0; pattern[i]; i++) {
+        int level = 0;
+        int tmp = pos + 1;
+        for (level = 0; level < morseTreeLevels; level++) {
+            if (((tmp + (1 << level)) % (2 << level)) == 0) break;
+        }
+        if (level == 0) return '\0';
+        int step = (1 << (level - 1));
+        if (pattern[i] == '.') pos -= step;
+        else if (pattern[i] == '-') pos += step;
+        else return '\0';
+    }
+    if (pos < 0 || pos >= morseTableLength) return '\0';
+    char ch = pgm_read_byte(morseTable + pos);
+    return (ch == '*') ? '\0' : ch;
+}
+
+void test_encode_matches_legacy_scan(void) {
+    char expected[8], actual[8];
+    for (int c = 0; c < 128; c++) {
+        if (c == '*') continue; // tree filler, never a real character
+        int n1 = legacyEncode((char)c, expected);
+        int n2 = morseEncode((char)c, actual);
+        TEST_ASSERT_EQUAL(n1, n2);
+        TEST_ASSERT_EQUAL_STRING(expected, actual);
+    }
+}
+
+void test_decode_matches_legacy_for_every_code(void) {
+    char pattern[8];
+    for (int len = 0; len <= MORSE_MAX_ELEMENTS; len++) {
+        for (int bits = 0; bits < (1 << len); bits++) {
+            for (int i = 0; i < len; i++) {
+                pattern[i] = ((bits >> (len - 1 - i)) & 1) ? '-' : '.';
+            }
+            pattern[len] = '\0';
+            MorseCode code = { (uint8_t)len, (uint8_t)bits };
+            TEST_ASSERT_EQUAL_CHAR(legacyDecode(pattern), morseCharFor(code));
+            TEST_ASSERT_EQUAL_CHAR(legacyDecode(pattern), morseDecode(pattern));
+        }
+    }
+}
+
+void test_code_for_known_chars(void) {
+    MorseCode a = morseCodeFor('A');
+    TEST_ASSERT_EQUAL(2, a.len);
+    TEST_ASSERT_EQUAL(0x1, a.bits); // .-
+    MorseCode b = morseCodeFor('b');
+    TEST_ASSERT_EQUAL(4, b.len);
+    TEST_ASSERT_EQUAL(0x8, b.bits); // -...
+    TEST_ASSERT_EQUAL(0, morseCodeFor(' ').len);
+    TEST_ASSERT_EQUAL(MORSE_NO_CODE, morseCodeFor(3).len);
+    TEST_ASSERT_EQUAL(MORSE_NO_CODE, morseCodeFor((char)0xC4).len);
+}
+
+void test_char_for_rejects_malformed_code(void) {
+    MorseCode code = { 7, 0 };
+    TEST_ASSERT_EQUAL_CHAR('\0', morseCharFor(code));
+    // Bits set above len would index past the level's table entries
+    code = { 2, 0x05 };
+    TEST_ASSERT_EQUAL_CHAR('\0', morseCharFor(code));
+    code = { 6, 0xC0 };
+    TEST_ASSERT_EQUAL_CHAR('\0', morseCharFor(code));
+    code = { 0, 0xFF };
+    TEST_ASSERT_EQUAL_CHAR('\0', morseCharFor(code));
+}
+
+void test_code_append_builds_keyed_pattern(void) {
+    MorseCode code = { 0, 0 };
+    TEST_ASSERT_TRUE(code.append(true));
+    TEST_ASSERT_TRUE(code.append(false));
+    TEST_ASSERT_TRUE(code.append(true));
+    TEST_ASSERT_TRUE(code.append(false));
+    TEST_ASSERT_EQUAL_CHAR('C', morseCharFor(code));
+    TEST_ASSERT_TRUE(code.isDah(0));
+    TEST_ASSERT_FALSE(code.isDah(3));
+}
+
+void test_code_append_stops_at_max_elements(void) {
+    MorseCode code = { 0, 0 };
+    for (int i = 0; i < MORSE_MAX_ELEMENTS; i++) {
+        TEST_ASSERT_TRUE(code.append(false));
+    }
+    TEST_ASSERT_FALSE(code.append(false));
+    TEST_ASSERT_EQUAL(MORSE_MAX_ELEMENTS, code.len);
+}
+
+void test_code_to_string_renders_space_and_unknown(void) {
+    char buf[8];
+    TEST_ASSERT_EQUAL(1, morseCodeToString(morseCodeFor(' '), buf));
+    TEST_ASSERT_EQUAL_STRING(" ", buf);
+    TEST_ASSERT_EQUAL(0, morseCodeToString(morseCodeFor(3), buf));
+    TEST_ASSERT_EQUAL_STRING("", buf);
+    TEST_ASSERT_EQUAL(5, morseCodeToString(morseCodeFor('1'), buf));
+    TEST_ASSERT_EQUAL_STRING(".----", buf);
+}
+
+// Not a pass/fail check — prints ns/op for the old scan vs table lookup.
+void test_benchmark_encode_decode_tables(void) {
+    const int rounds = 20000;
+    char buf[8];
+    volatile unsigned sink = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (char ch = '!'; ch <= 'Z'; ch++) sink += legacyEncode(ch, buf);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (char ch = '!'; ch <= 'Z'; ch++) sink += morseCodeFor(ch).bits;
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (char ch = '!'; ch <= 'Z'; ch++) {
+            legacyEncode(ch, buf);
+            sink += legacyDecode(buf);
+        }
+    }
+    auto t3 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (char ch = '!'; ch <= 'Z'; ch++) sink += morseCharFor(morseCodeFor(ch));
+    }
+    auto t4 = std::chrono::steady_clock::now();
+
+    double ops = (double)rounds * ('Z' - '!' + 1);
+    auto ns = [ops](std::chrono::steady_clock::time_point a,
+                     std::chrono::steady_clock::time_point b) {
+        return std::chrono::duration<double, std::nano>(b - a).count() / ops;
+    };
+    char msg[128];
+    snprintf(msg, sizeof(msg), "encode: scan %.1f ns/op, table %.1f ns/op",
+             ns(t0, t1), ns(t1, t2));
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "round-trip: scan %.1f ns/op, table %.1f ns/op",
+             ns(t2, t3), ns(t3, t4));
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_GREATER_THAN(0, (int)sink);
+}
+
 // ==========================================
 // Profile Tests
 // ==========================================
@@ -233,6 +441,1220 @@ void test_profile_each_has_at_least_one_nonzero(void) {
     }
 }
 
+// ==========================================
+// Log Histogram
+// ==========================================
+
+void test_histogram_bucket_boundaries(void) {
+    TEST_ASSERT_EQUAL(0, LogHistogram::bucketOf(0));
+    TEST_ASSERT_EQUAL(1, LogHistogram::bucketOf(1));
+    TEST_ASSERT_EQUAL(2, LogHistogram::bucketOf(2));
+    TEST_ASSERT_EQUAL(2, LogHistogram::bucketOf(3));
+    TEST_ASSERT_EQUAL(11, LogHistogram::bucketOf(1024));
+    TEST_ASSERT_EQUAL(32, LogHistogram::bucketOf(0xFFFFFFFFUL));
+    TEST_ASSERT_EQUAL(3, LogHistogram::bucketUpper(2));
+    TEST_ASSERT_EQUAL(1023, LogHistogram::bucketUpper(10));
+}
+
+void test_histogram_percentiles(void) {
+    LogHistogram h;
+    h.reset();
+    TEST_ASSERT_EQUAL(0, h.percentile(99));
+    for (int i = 0; i < 98; i++) h.record(5);   // bucket [4, 7]
+    h.record(300);                              // bucket [256, 511]
+    h.record(2000);                             // bucket [1024, 2047]
+    TEST_ASSERT_EQUAL(100, h.count());
+    TEST_ASSERT_EQUAL(2000, h.max());
+    TEST_ASSERT_EQUAL(7, h.percentile(50));
+    TEST_ASSERT_EQUAL(511, h.percentile(99));
+    TEST_ASSERT_EQUAL(2000, h.percentile(100)); // clamped to max
+    TEST_ASSERT_EQUAL((98 * 5 + 300 + 2000) / 100, h.mean());
+}
+
+void test_histogram_reset_clears_everything(void) {
+    LogHistogram h;
+    h.record(42);
+    h.reset();
+    TEST_ASSERT_EQUAL(0, h.count());
+    TEST_ASSERT_EQUAL(0, h.max());
+    TEST_ASSERT_EQUAL(0, h.bucketCount(LogHistogram::bucketOf(42)));
+}
+
+// ==========================================
+// PARIS Timing Model
+// ==========================================
+
+// Segment-by-segment, the way the engine compiles its timeline
+static uint32_t parisWordUs(const MorseTiming::Timing& t) {
+    MorseTiming::Cursor cursor;
+    uint32_t total = 0;
+    for (const char* p = "PARIS "; *p; p++) {
+        MorseCode code = morseCodeFor(*p);
+        if (code.isSpace()) {
+            total += cursor.advance(t.wordGap - t.interGap);
+            continue;
+        }
+        for (uint8_t i = 0; i < code.len; i++) {
+            total += cursor.advance(code.isDah(i) ? t.dah : t.dit);
+            total += cursor.advance(i + 1 < code.len ? t.intraGap : t.interGap);
+        }
+    }
+    return total;
+}
+
+void test_timing_paris_word_is_60_over_wpm(void) {
+    // speed is characters per minute: W = speed / 5, so 60/W s = 300/speed s
+    TEST_ASSERT_EQUAL_UINT32(12000000, parisWordUs(MorseTiming::compute(25)));
+    TEST_ASSERT_EQUAL_UINT32(3000000, parisWordUs(MorseTiming::compute(100)));
+    for (int speed = MIN_SPEED; speed <= MAX_SPEED; speed++) {
+        uint32_t us = parisWordUs(MorseTiming::compute(speed));
+        if (300000000UL % speed == 0) {
+            // Whole microseconds: exact
+            TEST_ASSERT_EQUAL_UINT32(300000000UL / speed, us);
+        } else {
+            // Otherwise within a microsecond of the true value
+            int64_t err = (int64_t)us * speed - 300000000LL;
+            TEST_ASSERT_TRUE(err > -speed && err < speed);
+        }
+    }
+}
+
+void test_timing_units_match_paris(void) {
+    MorseTiming::Timing t = MorseTiming::compute(25);
+    TEST_ASSERT_EQUAL_UINT32(240000, MorseTiming::toUs(t.dit));
+    TEST_ASSERT_EQUAL_UINT32(720000, MorseTiming::toUs(t.dah));
+    TEST_ASSERT_EQUAL_UINT32(240000, MorseTiming::toUs(t.intraGap));
+    TEST_ASSERT_EQUAL_UINT32(720000, MorseTiming::toUs(t.interGap));
+    TEST_ASSERT_EQUAL_UINT32(1680000, MorseTiming::toUs(t.wordGap));
+    // "PARIS " without the word gap: P(11+3) A(5+3) R(7+3) I(3+3) S(5) = 43 units
+    uint32_t q = 0;
+    for (const char* p = "PARIS"; *p; p++) q += MorseTiming::charQ(t, morseCodeFor(*p));
+    q += MorseTiming::charQ(t, morseCodeFor(' '));
+    TEST_ASSERT_EQUAL_UINT32(12000000, MorseTiming::toUs(q));
+}
+
+void test_timing_farnsworth_word_at_effective_speed(void) {
+    // Elements at 100 (20 WPM), word paced at 50 (10 WPM)
+    MorseTiming::Timing t = MorseTiming::compute(100, 50);
+    TEST_ASSERT_EQUAL_UINT32(60000, MorseTiming::toUs(t.dit));
+    TEST_ASSERT_EQUAL_UINT32(60000, MorseTiming::toUs(t.intraGap));
+    TEST_ASSERT_UINT32_WITHIN(1, 6000000, parisWordUs(t));
+    for (int s = MIN_SPEED; s <= MAX_SPEED; s += 7) {
+        for (int c = s; c <= MAX_SPEED; c += 13) {
+            uint32_t expected = (300000000UL + s / 2) / s;
+            TEST_ASSERT_UINT32_WITHIN(1, expected, parisWordUs(MorseTiming::compute(c, s)));
+        }
+    }
+}
+
+void test_timing_farnsworth_off_when_not_slower(void) {
+    MorseTiming::Timing a = MorseTiming::compute(60);
+    MorseTiming::Timing b = MorseTiming::compute(60, 60);
+    MorseTiming::Timing c = MorseTiming::compute(60, 80);
+    TEST_ASSERT_EQUAL_UINT32(a.interGap, b.interGap);
+    TEST_ASSERT_EQUAL_UINT32(a.wordGap, b.wordGap);
+    TEST_ASSERT_EQUAL_UINT32(a.interGap, c.interGap);
+    TEST_ASSERT_EQUAL_UINT32(a.wordGap, c.wordGap);
+}
+
+// ==========================================
+// Weighted Sampler / PRNG
+// ==========================================
+
+// The trainer's original linear draw: first index whose running sum
+// exceeds the target
+static int scanPick(const uint8_t* w, int n, uint32_t target) {
+    uint32_t sum = 0;
+    int index = 0;
+    while (sum <= target && index < n) {
+        sum += w[index];
+        index++;
+    }
+    return index - 1;
+}
+
+void test_sampler_matches_linear_scan(void) {
+    uint8_t w[CHAR_COUNT];
+    const uint8_t* p = getProfile(1);
+    for (int i = 0; i < CHAR_COUNT; i++) w[i] = pgm_read_byte(p + i);
+
+    WeightedSampler<CHAR_COUNT> s;
+    s.build(w);
+    uint32_t total = 0;
+    for (int i = 0; i < CHAR_COUNT; i++) total += w[i];
+    TEST_ASSERT_EQUAL_UINT32(total, s.total());
+    for (uint32_t t = 0; t < total; t++) {
+        TEST_ASSERT_EQUAL(scanPick(w, CHAR_COUNT, t), s.find(t));
+    }
+}
+
+void test_sampler_incremental_updates_match_rebuild(void) {
+    uint8_t w[CHAR_COUNT] = {};
+    WeightedSampler<CHAR_COUNT> s;
+    s.clear();
+    FastRng rng(1234);
+    for (int n = 0; n < 2000; n++) {
+        uint16_t i = rng.below(CHAR_COUNT);
+        w[i] = rng.below(101);
+        s.set(i, w[i]);
+    }
+    WeightedSampler<CHAR_COUNT> fresh;
+    fresh.build(w);
+    TEST_ASSERT_EQUAL_UINT32(fresh.total(), s.total());
+    for (uint32_t t = 0; t < s.total(); t++) {
+        TEST_ASSERT_EQUAL(fresh.find(t), s.find(t));
+        TEST_ASSERT_EQUAL(scanPick(w, CHAR_COUNT, t), s.find(t));
+    }
+}
+
+void test_sampler_skips_zero_weights_and_empty(void) {
+    WeightedSampler<5> s;
+    s.clear();
+    FastRng rng(7);
+    TEST_ASSERT_EQUAL(5, s.sample(rng));   // nothing to draw
+    s.set(3, 10);
+    for (int n = 0; n < 100; n++) TEST_ASSERT_EQUAL(3, s.sample(rng));
+    s.set(3, 0);
+    s.set(4, 1);
+    TEST_ASSERT_EQUAL(4, s.sample(rng));
+}
+
+void test_rng_seeded_and_in_range(void) {
+    FastRng a(42), b(42), c(43);
+    bool differs = false;
+    for (int n = 0; n < 100; n++) {
+        uint32_t x = a.next();
+        TEST_ASSERT_EQUAL_UINT32(x, b.next());
+        if (x != c.next()) differs = true;
+    }
+    TEST_ASSERT_TRUE(differs);
+
+    FastRng zero(0);   // must not get stuck at zero
+    TEST_ASSERT_NOT_EQUAL(0, zero.next());
+
+    int hist[10] = {};
+    for (int n = 0; n < 10000; n++) {
+        uint32_t v = a.below(10);
+        TEST_ASSERT_LESS_THAN(10, v);
+        hist[v]++;
+    }
+    for (int i = 0; i < 10; i++) TEST_ASSERT_INT_WITHIN(200, 1000, hist[i]);
+}
+
+template <uint16_t N>
+static void benchmarkSampler(char* msg, size_t len) {
+    static uint8_t w[N];
+    FastRng rng(99);
+    for (int i = 0; i < N; i++) w[i] = 1 + rng.below(100);
+    WeightedSampler<N> s;
+    s.build(w);
+
+    // Each draw follows one weight change, like a typed answer
+    const int rounds = 200000;
+    volatile unsigned sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        w[r % N] = 1 + (r & 63);
+        uint32_t total = 0;
+        for (int i = 0; i < N; i++) total += w[i];
+        sink += scanPick(w, N, rng.below(total));
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        s.set(r % N, 1 + (r & 63));
+        sink += s.sample(rng);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    auto ns = [rounds](std::chrono::steady_clock::time_point a,
+                        std::chrono::steady_clock::time_point b) {
+        return std::chrono::duration<double, std::nano>(b - a).count() / rounds;
+    };
+    snprintf(msg, len, "update+draw, %u chars: scan %.1f ns/op, fenwick %.1f ns/op",
+             (unsigned)N, ns(t0, t1), ns(t1, t2));
+    TEST_ASSERT_GREATER_THAN(0, (int)sink);
+}
+
+void test_benchmark_sampler_vs_scan(void) {
+    char msg[128];
+    benchmarkSampler<CHAR_COUNT>(msg, sizeof(msg));
+    TEST_MESSAGE(msg);
+    benchmarkSampler<512>(msg, sizeof(msg));
+    TEST_MESSAGE(msg);
+}
+
+// ==========================================
+// Confusion Matrix
+// ==========================================
+
+void test_confusion_records_ordered_pairs(void) {
+    ConfusionMatrix m;
+    m.record('B', '6');
+    m.record('B', '6');
+    m.record('S', 'H');
+    TEST_ASSERT_EQUAL(2, m.count('B', '6'));
+    TEST_ASSERT_EQUAL(0, m.count('6', 'B'));
+    TEST_ASSERT_EQUAL(1, m.count('S', 'H'));
+    TEST_ASSERT_EQUAL(2, m.size());
+}
+
+void test_confusion_ignores_same_and_out_of_range(void) {
+    ConfusionMatrix m;
+    m.record('A', 'A');
+    m.record('A', ' ');
+    m.record('a', 'B');   // lowercase is outside the trained range
+    TEST_ASSERT_EQUAL(0, m.size());
+}
+
+void test_confusion_saturates(void) {
+    ConfusionMatrix m;
+    for (int i = 0; i < 300; i++) m.record('S', 'H');
+    TEST_ASSERT_EQUAL(255, m.count('S', 'H'));
+}
+
+void test_confusion_top_sorted(void) {
+    ConfusionMatrix m;
+    for (int i = 0; i < 3; i++) m.record('U', 'V');
+    for (int i = 0; i < 7; i++) m.record('B', '6');
+    for (int i = 0; i < 5; i++) m.record('S', 'H');
+    m.record('E', 'I');
+    ConfusionMatrix::Entry top[3];
+    TEST_ASSERT_EQUAL(3, m.top(top, 3));
+    TEST_ASSERT_EQUAL_CHAR('B', top[0].expected);
+    TEST_ASSERT_EQUAL(7, top[0].count);
+    TEST_ASSERT_EQUAL_CHAR('S', top[1].expected);
+    TEST_ASSERT_EQUAL_CHAR('U', top[2].expected);
+}
+
+void test_confusion_ages_when_full(void) {
+    ConfusionMatrix m;
+    for (int i = 0; i < 40; i++) m.record('B', '6');
+    // Far more distinct one-off pairs than slots
+    for (char e = FIRST_CHAR; e <= LAST_CHAR; e++) {
+        for (char t = FIRST_CHAR; t <= FIRST_CHAR + 5; t++) m.record(e, t);
+    }
+    TEST_ASSERT_LESS_THAN(CONFUSION_SLOTS, m.size());
+    TEST_ASSERT_GREATER_THAN(0, m.count('B', '6'));
+    ConfusionMatrix::Entry top[1];
+    m.top(top, 1);
+    TEST_ASSERT_EQUAL_CHAR('B', top[0].expected);
+    TEST_ASSERT_EQUAL_CHAR('6', top[0].typed);
+}
+
+void test_confusion_raw_roundtrip(void) {
+    ConfusionMatrix m;
+    for (int i = 0; i < 4; i++) m.record('B', '6');
+    m.record('Q', 'Y');
+    ConfusionMatrix::Entry raw[CONFUSION_SLOTS];
+    memcpy(raw, m.raw(), ConfusionMatrix::BYTES);
+    raw[0] = ConfusionMatrix::Entry{ 'A', 'A', 9 };   // invalid, dropped on load
+
+    ConfusionMatrix back;
+    back.load(raw);
+    TEST_ASSERT_EQUAL(4, back.count('B', '6'));
+    TEST_ASSERT_EQUAL(1, back.count('Q', 'Y'));
+    TEST_ASSERT_EQUAL(0, back.count('A', 'A'));
+}
+
+// ==========================================
+// Input Aligner
+// ==========================================
+
+// Sent index each typed char lines up with, as a string: digit or 'x'
+static void alignPositions(const char* sent, const char* typed, char* out) {
+    int8_t pos[InputAligner::MAX_TYPED];
+    uint8_t n = (uint8_t)strlen(typed);
+    InputAligner::align(sent, (uint8_t)strlen(sent), typed, n, pos);
+    for (uint8_t i = 0; i < n; i++) {
+        out[i] = pos[i] == InputAligner::EXTRA ? 'x' : (char)('0' + pos[i]);
+    }
+    out[n] = '\0';
+}
+
+void test_align_exact_and_substitution(void) {
+    char out[8];
+    alignPositions("ABCDE", "ABC", out);
+    TEST_ASSERT_EQUAL_STRING("012", out);
+    alignPositions("ABCDE", "AXC", out);     // X replaces B
+    TEST_ASSERT_EQUAL_STRING("012", out);
+    alignPositions("ABCDE", "AX", out);      // undecided: substitute, like before
+    TEST_ASSERT_EQUAL_STRING("01", out);
+}
+
+void test_align_missed_char_resyncs(void) {
+    char out[8];
+    alignPositions("ABCDE", "AC", out);      // B never typed
+    TEST_ASSERT_EQUAL_STRING("02", out);
+    alignPositions("ABCDE", "AD", out);      // one char can't tell yet
+    TEST_ASSERT_EQUAL_STRING("01", out);
+    alignPositions("ABCDE", "ADE", out);     // B and C never typed
+    TEST_ASSERT_EQUAL_STRING("034", out);
+}
+
+void test_align_extra_char_resyncs(void) {
+    char out[8];
+    alignPositions("ABCDE", "AXB", out);     // X was extra, B still matches
+    TEST_ASSERT_EQUAL_STRING("0x1", out);
+    alignPositions("ABCDE", "AABC", out);    // doubled A
+    TEST_ASSERT_EQUAL_STRING("0x12", out);
+}
+
+void test_align_cost_counts_edits(void) {
+    int8_t pos[InputAligner::MAX_TYPED];
+    TEST_ASSERT_EQUAL(0, InputAligner::align("PARIS", 5, "PARIS", 5, pos));
+    TEST_ASSERT_EQUAL(1, InputAligner::align("PARIS", 5, "PRIS", 4, pos));
+    TEST_ASSERT_EQUAL(1, InputAligner::align("PARIS", 5, "PAARIS", 6, pos));
+    TEST_ASSERT_EQUAL(2, InputAligner::align("PARIS", 5, "PRAIS", 5, pos));
+}
+
+// Results from keying typed against sent one char at a time, as the
+// trainer scores them: "typed:sent" for a scored keystroke, "-sent" for
+// a missed char, "+typed" for an extra one
+static void scoreKeys(const char* sent, const char* typed, char* out) {
+    using namespace InputAligner;
+    int8_t pos[MAX_TYPED];
+    uint8_t recv = 0;
+    uint16_t scored = 0;
+    out[0] = '\0';
+    for (uint8_t n = 1; n <= strlen(typed); n++) {
+        align(sent, (uint8_t)strlen(sent), typed, n, pos);
+        int8_t p = pos[n - 1];
+        Step st = step(p, recv, scored);
+        char* o = out + strlen(out);
+        if (p == EXTRA) {
+            o += sprintf(o, "+%c ", typed[n - 1]);
+            continue;
+        }
+        for (uint8_t i = recv; i < p; i++) {
+            if (st.missed & (1u << i)) o += sprintf(o, "-%c ", sent[i]);
+        }
+        if (st.score) o += sprintf(o, "%c:%c ", typed[n - 1], sent[p]);
+        recv = p + 1;
+    }
+}
+
+void test_align_step_scores_each_sent_char_once(void) {
+    char out[64];
+    scoreKeys("AB", "XA", out);       // X scored against A, then read as extra
+    TEST_ASSERT_EQUAL_STRING("X:A ", out);
+    scoreKeys("AB", "XAB", out);      // and B is still next
+    TEST_ASSERT_EQUAL_STRING("X:A B:B ", out);
+    scoreKeys("ABCDE", "ACD", out);   // B missed once, C and D scored
+    TEST_ASSERT_EQUAL_STRING("A:A -B C:C D:D ", out);
+    scoreKeys("ABCDE", "ABXC", out);  // X scored against C, then read as extra
+    TEST_ASSERT_EQUAL_STRING("A:A B:B X:C ", out);
+
+    // A stepped-back slot that was missed is not missed again
+    uint16_t scored = 0;
+    InputAligner::Step st = InputAligner::step(2, 0, scored);
+    TEST_ASSERT_EQUAL(0x0003, st.missed);
+    TEST_ASSERT_TRUE(st.score);
+    st = InputAligner::step(1, 3, scored);
+    TEST_ASSERT_EQUAL(0, st.missed);
+    TEST_ASSERT_FALSE(st.score);
+    st = InputAligner::step(4, 2, scored);
+    TEST_ASSERT_EQUAL(0x0008, st.missed);
+    TEST_ASSERT_TRUE(st.score);
+}
+
+// ==========================================
+// Ring Buffer
+// ==========================================
+
+void test_ring_fifo_wraps_slots(void) {
+    RingBuffer<int, 4> rb;
+    int v = 0;
+    // Many times around the 4 slots, at every fill level
+    for (int round = 0; round < 50; round++) {
+        int fill = round % 5;
+        for (int i = 0; i < fill; i++) TEST_ASSERT_TRUE(rb.push(round * 10 + i));
+        TEST_ASSERT_EQUAL(fill, rb.size());
+        for (int i = 0; i < fill; i++) {
+            TEST_ASSERT_TRUE(rb.pop(v));
+            TEST_ASSERT_EQUAL(round * 10 + i, v);
+        }
+        TEST_ASSERT_TRUE(rb.empty());
+    }
+    TEST_ASSERT_FALSE(rb.pop(v));
+}
+
+void test_ring_full_rejects_push(void) {
+    RingBuffer<uint8_t, 4> rb;
+    for (uint8_t i = 0; i < 4; i++) TEST_ASSERT_TRUE(rb.push(i));
+    TEST_ASSERT_TRUE(rb.full());
+    TEST_ASSERT_EQUAL(0, rb.free());
+    TEST_ASSERT_FALSE(rb.push(9));
+    uint8_t v = 0;
+    rb.pop(v);
+    TEST_ASSERT_EQUAL(0, v);
+    TEST_ASSERT_TRUE(rb.push(9));
+    TEST_ASSERT_EQUAL(1, rb.peek(0));
+    TEST_ASSERT_EQUAL(9, rb.peek(3));
+    rb.clear();
+    TEST_ASSERT_TRUE(rb.empty());
+}
+
+void test_ring_lookahead_and_lookbehind(void) {
+    RingBuffer<char, 8> rb;
+    const char* text = "PARIS PARIS";
+    for (int i = 0; i < 6; i++) rb.push(text[i]);
+    TEST_ASSERT_EQUAL(4, rb.skip(4));         // consumed P A R I
+    TEST_ASSERT_EQUAL('S', rb.peek(0));
+    TEST_ASSERT_EQUAL(' ', rb.peek(1));
+    TEST_ASSERT_EQUAL('I', rb.behind(1));
+    TEST_ASSERT_EQUAL('P', rb.behind(4));
+
+    // Pushes reuse consumed slots; lookbehind shrinks to free()
+    for (int i = 6; i < 11; i++) rb.push(text[i]);
+    TEST_ASSERT_EQUAL(7, rb.size());
+    TEST_ASSERT_EQUAL(1, rb.free());
+    TEST_ASSERT_EQUAL('I', rb.behind(1));
+    TEST_ASSERT_EQUAL(1, rb.rewind(3));       // only one consumed slot intact
+    TEST_ASSERT_EQUAL('I', rb.peek(0));
+    TEST_ASSERT_EQUAL(8, rb.skip(20));        // clamps to what is unread
+    TEST_ASSERT_TRUE(rb.empty());
+}
+
+void test_ring_sequence_numbers_wrap_16_bits(void) {
+    RingBuffer<uint32_t, 8> rb;
+    uint32_t v;
+    // Push values through until the head has wrapped past 0xFFFF but the
+    // tail has not
+    for (uint32_t i = 0; i < 65538; i++) {
+        TEST_ASSERT_TRUE(rb.push(i));
+        if (i >= 5) {
+            TEST_ASSERT_TRUE(rb.pop(v));
+            TEST_ASSERT_EQUAL_UINT32(i - 5, v);
+            TEST_ASSERT_EQUAL(5, rb.size());
+        }
+    }
+    TEST_ASSERT_TRUE(rb.head() < rb.tail());  // wrapped, size() still right
+    TEST_ASSERT_EQUAL(5, rb.size());
+    TEST_ASSERT_EQUAL_UINT32(65533, rb.peek(0));
+    TEST_ASSERT_EQUAL_UINT32(65533, rb.at(rb.tail()));
+    TEST_ASSERT_EQUAL(5, (RingBuffer<uint32_t, 8>::distance(rb.tail(), rb.head())));
+    TEST_ASSERT_EQUAL(-5, (RingBuffer<uint32_t, 8>::distance(rb.head(), rb.tail())));
+}
+
+// ==========================================
+// Event Bus
+// ==========================================
+
+struct BusEvent {
+    enum Type : uint8_t { TICK, STATE };
+    static const uint8_t TYPE_COUNT = 2;
+    Type type;
+    int value;
+};
+
+using TestBus = EventBus<BusEvent, 4, 3>;
+
+static int busSeen[2][16];
+static int busSeenCount[2];
+static bool busReady = true;
+
+static void busSinkA(const BusEvent& e) { busSeen[0][busSeenCount[0]++] = e.value; }
+static void busSinkB(const BusEvent& e) { busSeen[1][busSeenCount[1]++] = e.value; }
+static bool busIsReady() { return busReady; }
+
+static void busPublish(TestBus& bus, BusEvent::Type type, int value) {
+    BusEvent e = { type, value };
+    bus.publish(e);
+}
+
+static void busResetSeen() {
+    busSeenCount[0] = busSeenCount[1] = 0;
+    busReady = true;
+}
+
+void test_bus_fans_out_within_budget(void) {
+    busResetSeen();
+    TestBus bus;
+    TEST_ASSERT_EQUAL(0, bus.addSink("a", busSinkA, TestBus::DROP_OLDEST, 1));
+    TEST_ASSERT_EQUAL(1, bus.addSink("b", busSinkB, TestBus::DROP_OLDEST));
+    for (int i = 1; i <= 3; i++) busPublish(bus, BusEvent::TICK, i);
+    TEST_ASSERT_EQUAL(0, busSeenCount[0]);      // publish never delivers
+
+    bus.drain();
+    TEST_ASSERT_EQUAL(1, busSeenCount[0]);      // budget 1 per pass
+    TEST_ASSERT_EQUAL(3, busSeenCount[1]);      // unlimited
+    TEST_ASSERT_EQUAL(2, bus.stats(0).depth);
+    bus.drain();
+    bus.drain();
+    TEST_ASSERT_EQUAL(3, busSeenCount[0]);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(i + 1, busSeen[0][i]);
+        TEST_ASSERT_EQUAL(i + 1, busSeen[1][i]);
+    }
+    TEST_ASSERT_EQUAL(3, bus.stats(0).maxDepth);
+    TEST_ASSERT_EQUAL_STRING("b", bus.sinkName(1));
+}
+
+void test_bus_drop_policies_count_losses(void) {
+    busResetSeen();
+    TestBus bus;
+    bus.addSink("oldest", busSinkA, TestBus::DROP_OLDEST);
+    bus.addSink("newest", busSinkB, TestBus::DROP_NEWEST);
+    for (int i = 1; i <= 6; i++) busPublish(bus, BusEvent::TICK, i);
+    TEST_ASSERT_EQUAL(2, bus.stats(0).dropped);
+    TEST_ASSERT_EQUAL(2, bus.stats(1).dropped);
+    bus.drain();
+    TEST_ASSERT_EQUAL(4, busSeenCount[0]);
+    TEST_ASSERT_EQUAL(3, busSeen[0][0]);        // 1 and 2 lost
+    TEST_ASSERT_EQUAL(6, busSeen[0][3]);
+    TEST_ASSERT_EQUAL(1, busSeen[1][0]);        // 5 and 6 lost
+    TEST_ASSERT_EQUAL(4, busSeen[1][3]);
+    TEST_ASSERT_EQUAL(4, bus.stats(0).delivered);
+}
+
+void test_bus_coalesce_keeps_latest_per_type(void) {
+    busResetSeen();
+    TestBus bus;
+    bus.addSink("state", busSinkA, TestBus::COALESCE);
+    busPublish(bus, BusEvent::STATE, 10);
+    busPublish(bus, BusEvent::TICK, 1);
+    busPublish(bus, BusEvent::STATE, 20);
+    busPublish(bus, BusEvent::TICK, 2);
+    bus.drain();
+    TEST_ASSERT_EQUAL(2, busSeenCount[0]);
+    TEST_ASSERT_EQUAL(20, busSeen[0][0]);       // order kept among survivors
+    TEST_ASSERT_EQUAL(2, busSeen[0][1]);
+    TEST_ASSERT_EQUAL(2, bus.stats(0).coalesced);
+}
+
+void test_bus_waits_for_ready_sink(void) {
+    busResetSeen();
+    TestBus bus;
+    bus.addSink("slow", busSinkA, TestBus::DROP_OLDEST, 0, busIsReady);
+    bus.addSink("fast", busSinkB, TestBus::DROP_OLDEST);
+    busReady = false;
+    busPublish(bus, BusEvent::TICK, 1);
+    bus.drain();
+    TEST_ASSERT_EQUAL(0, busSeenCount[0]);      // slow sink holds its queue
+    TEST_ASSERT_EQUAL(1, busSeenCount[1]);      // others unaffected
+    TEST_ASSERT_EQUAL(1, bus.stats(0).depth);
+    busReady = true;
+    bus.drain();
+    TEST_ASSERT_EQUAL(1, busSeenCount[0]);
+    bus.resetStats();
+    TEST_ASSERT_EQUAL(0, bus.stats(0).delivered);
+}
+
+// ==========================================
+// Event Log
+// ==========================================
+
+void test_log_numbers_and_overwrites_oldest(void) {
+    EventLog<uint16_t, 8> log;
+    TEST_ASSERT_EQUAL_UINT32(0, log.lastSeq());
+    TEST_ASSERT_TRUE(log.canResumeAfter(0));       // nothing to miss yet
+    TEST_ASSERT_FALSE(log.contains(0));
+    for (uint16_t v = 1; v <= 5; v++) TEST_ASSERT_EQUAL_UINT32(v, log.append(v * 10));
+    TEST_ASSERT_EQUAL_UINT32(1, log.firstSeq());
+    TEST_ASSERT_EQUAL(30, log.get(3));
+    TEST_ASSERT_TRUE(log.canResumeAfter(0));
+    TEST_ASSERT_TRUE(log.canResumeAfter(5));
+    TEST_ASSERT_FALSE(log.canResumeAfter(6));      // from the future
+
+    for (uint16_t v = 6; v <= 12; v++) log.append(v * 10);
+    TEST_ASSERT_EQUAL(8, log.size());
+    TEST_ASSERT_EQUAL_UINT32(5, log.firstSeq());
+    TEST_ASSERT_EQUAL_UINT32(12, log.lastSeq());
+    TEST_ASSERT_EQUAL(50, log.get(5));
+    TEST_ASSERT_EQUAL(120, log.get(12));
+    TEST_ASSERT_TRUE(log.canResumeAfter(4));
+    TEST_ASSERT_FALSE(log.canResumeAfter(3));      // 4 was overwritten
+
+    log.clear();
+    TEST_ASSERT_EQUAL(0, log.size());
+    TEST_ASSERT_EQUAL_UINT32(13, log.append(130)); // numbering carries on
+    TEST_ASSERT_EQUAL_UINT32(13, log.firstSeq());
+}
+
+void test_log_lookup_past_16_bit_ring_wrap(void) {
+    EventLog<uint32_t, 16> log;
+    for (uint32_t v = 1; v <= 70000; v++) log.append(v);
+    TEST_ASSERT_EQUAL_UINT32(70000, log.lastSeq());
+    for (uint32_t seq = log.firstSeq(); seq <= log.lastSeq(); seq++) {
+        TEST_ASSERT_EQUAL_UINT32(seq, log.get(seq));
+    }
+}
+
+// ==========================================
+// Boot Timer
+// ==========================================
+
+void test_boot_phases_chain_and_background(void) {
+    BootTimer bt;
+    bt.mark("core", 30000);
+    bt.mark("storage", 95000);
+    bt.mark("web", 120000);
+    bt.markSince("wifi", 100000, 3100000);
+    TEST_ASSERT_EQUAL(4, bt.count());
+    TEST_ASSERT_EQUAL_UINT32(30000, bt.phase(0).us);   // from reset
+    TEST_ASSERT_EQUAL_UINT32(65000, bt.phase(1).us);
+    TEST_ASSERT_EQUAL_UINT32(95000, bt.phase(2).startUs);
+    TEST_ASSERT_FALSE(bt.phase(2).background);
+    TEST_ASSERT_TRUE(bt.phase(3).background);
+    TEST_ASSERT_EQUAL_UINT32(3000000, bt.phase(3).us);
+    TEST_ASSERT_EQUAL_UINT32(120000, bt.readyUs());    // background doesn't count
+
+    for (uint8_t i = 0; i < 20; i++) bt.mark("x", 200000 + i);
+    TEST_ASSERT_EQUAL(BootTimer::MAX_PHASES, bt.count());
+}
+
+// ==========================================
+// Write-Behind
+// ==========================================
+
+void test_write_behind_coalesces_until_quiet_and_idle(void) {
+    WriteBehind wb(2000);
+    TEST_ASSERT_FALSE(wb.due(0, true));
+    wb.mark(0x01, 1000);
+    wb.mark(0x04, 1500);
+    wb.mark(0x01, 2500);
+    TEST_ASSERT_EQUAL_UINT32(0x05, wb.dirty());
+    TEST_ASSERT_FALSE(wb.due(4000, true));   // last change only 1.5 s ago
+    TEST_ASSERT_FALSE(wb.due(4500, false));  // settled but busy
+    TEST_ASSERT_TRUE(wb.due(4500, true));
+    TEST_ASSERT_EQUAL_UINT32(0x05, wb.take());
+    TEST_ASSERT_FALSE(wb.due(9000, true));
+    TEST_ASSERT_EQUAL_UINT32(0, wb.take());
+    TEST_ASSERT_EQUAL_UINT32(3, wb.changes());
+    TEST_ASSERT_EQUAL_UINT32(1, wb.writes());   // one write for three changes
+}
+
+// ==========================================
+// Session Journal
+// ==========================================
+
+void test_journal_record_round_trip_and_saturation(void) {
+    Journal::Record r = { Journal::FLAG_CORRECT | Journal::FLAG_LATENCY, 'K', 'K', 35,
+                          Journal::sat16(70000), Journal::sat16(412) };
+    uint8_t raw[Journal::RECORD_LEN];
+    Journal::encode(r, raw);
+    TEST_ASSERT_EQUAL(0xFF, raw[4]);            // dt saturated
+    TEST_ASSERT_EQUAL(0xFF, raw[5]);
+    Journal::Record d = Journal::decode(raw);
+    TEST_ASSERT_EQUAL(r.flags, d.flags);
+    TEST_ASSERT_EQUAL_CHAR('K', d.expected);
+    TEST_ASSERT_EQUAL(35, d.speed);
+    TEST_ASSERT_EQUAL(65535, d.dtMs);
+    TEST_ASSERT_EQUAL(412, d.latencyMs);
+}
+
+void test_journal_csv_sessions_and_quoting(void) {
+    Journal::CsvWriter csv;
+    char line[Journal::CSV_LINE_MAX];
+    Journal::Record a = { Journal::FLAG_SESSION | Journal::FLAG_CORRECT | Journal::FLAG_LATENCY,
+                          'A', 'A', 25, 1200, 300 };
+    Journal::Record b = { 0, ',', '"', 25, 800, 0 };
+    Journal::Record c = { Journal::FLAG_SESSION, 'E', 'T', 30, 500, 0 };
+    csv.line(a, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("1,1200,A,A,1,25,300\n", line);
+    TEST_ASSERT_EQUAL(0, csv.line(b, line, 10));   // too short: not consumed
+    csv.line(b, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("1,2000,\",\",\"\"\"\",0,25,\n", line);
+    csv.line(c, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("2,500,E,T,0,30,\n", line);
+
+    Journal::CharTotals totals[CHAR_COUNT] = {};
+    Journal::fold(totals, a);
+    Journal::fold(totals, c);
+    Journal::fold(totals, { Journal::FLAG_LATENCY, 'A', 'N', 25, 0, 500 });
+    const Journal::CharTotals& ta = totals['A' - FIRST_CHAR];
+    TEST_ASSERT_EQUAL_UINT32(2, ta.attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, ta.correct);
+    TEST_ASSERT_EQUAL_UINT32(800, ta.latencySumMs);
+    TEST_ASSERT_EQUAL_UINT32(2, ta.latencyCount);
+    TEST_ASSERT_EQUAL_UINT32(1, totals['E' - FIRST_CHAR].attempts);
+}
+
+// ==========================================
+// Probability Store (file-backed FS shim)
+// ==========================================
+
+// A fresh directory per test for the shim's files
+static std::string storeDir(const char* name) {
+    std::filesystem::path d = std::filesystem::temp_directory_path() / "morse_prob_store" / name;
+    std::filesystem::remove_all(d);
+    std::filesystem::create_directories(d);
+    return d.string();
+}
+
+static void fillDefaults(uint8_t profile, uint8_t* out) {
+    memset(out, 100 + profile, CHAR_COUNT);
+}
+
+void test_prob_store_round_trip_per_profile(void) {
+    FS fs(storeDir("round_trip"));
+    ProbStore a(fs, "/a.bin", "/b.bin");
+    TEST_ASSERT_FALSE(a.load(fillDefaults));     // nothing saved yet
+
+    uint8_t p3[CHAR_COUNT], p7[CHAR_COUNT];
+    for (int i = 0; i < CHAR_COUNT; i++) { p3[i] = (uint8_t)i; p7[i] = (uint8_t)(200 - i); }
+    TEST_ASSERT_TRUE(a.putEach((1u << 3) | 1u, p3));
+    TEST_ASSERT_TRUE(a.put(7, p7));
+    TEST_ASSERT_EQUAL_UINT32(2, a.generation());
+    uint32_t writes = a.writes();
+    TEST_ASSERT_TRUE(a.put(7, p7));              // unchanged: no write
+    TEST_ASSERT_EQUAL_UINT32(writes, a.writes());
+
+    // Staged in RAM: readable at once, on flash only after save()
+    uint8_t p5[CHAR_COUNT], out[CHAR_COUNT];
+    memset(p5, 55, CHAR_COUNT);
+    TEST_ASSERT_TRUE(a.setEach(1u << 5, p5));
+    TEST_ASSERT_FALSE(a.setEach(1u << 5, p5));   // unchanged
+    TEST_ASSERT_EQUAL_UINT32(writes, a.writes());
+    TEST_ASSERT_TRUE(a.get(5, out));
+    TEST_ASSERT_EQUAL_MEMORY(p5, out, CHAR_COUNT);
+    ProbStore staged(fs, "/a.bin", "/b.bin");
+    TEST_ASSERT_TRUE(staged.load(fillDefaults));
+    TEST_ASSERT_FALSE(staged.get(5, out));
+    TEST_ASSERT_TRUE(a.save());
+    TEST_ASSERT_EQUAL_UINT32(3, a.generation());
+
+    ProbStore b(fs, "/a.bin", "/b.bin");
+    TEST_ASSERT_TRUE(b.load(fillDefaults));
+    TEST_ASSERT_EQUAL_UINT32(3, b.generation());
+    TEST_ASSERT_TRUE(b.get(5, out));
+    TEST_ASSERT_EQUAL_MEMORY(p5, out, CHAR_COUNT);
+    TEST_ASSERT_FALSE(b.get(1, out));
+    TEST_ASSERT_TRUE(b.get(0, out));
+    TEST_ASSERT_EQUAL_MEMORY(p3, out, CHAR_COUNT);
+    TEST_ASSERT_TRUE(b.get(7, out));
+    TEST_ASSERT_EQUAL_MEMORY(p7, out, CHAR_COUNT);
+}
+
+void test_prob_store_survives_power_cut_mid_save(void) {
+    FS fs(storeDir("power_cut"));
+    ProbStore a(fs, "/a.bin", "/b.bin");
+    uint8_t good[CHAR_COUNT], next[CHAR_COUNT];
+    memset(good, 42, CHAR_COUNT);
+    memset(next, 43, CHAR_COUNT);
+    TEST_ASSERT_TRUE(a.put(1, good));
+    TEST_ASSERT_TRUE(a.put(2, good));           // both slots written once
+
+    fs.writeBudget = 100;                        // power fails 100 bytes in
+    TEST_ASSERT_FALSE(a.put(1, next));
+    fs.writeBudget = -1;
+
+    ProbStore b(fs, "/a.bin", "/b.bin");
+    TEST_ASSERT_TRUE(b.load(fillDefaults));     // torn slot rejected by length/CRC
+    TEST_ASSERT_EQUAL_UINT32(3, b.generation());
+    TEST_ASSERT_TRUE(b.get(5, out));
+    TEST_ASSERT_EQUAL_MEMORY(p5, out, CHAR_COUNT);
+    TEST_ASSERT_TRUE(b.get(1, out));
+    TEST_ASSERT_EQUAL_MEMORY(good, out, CHAR_COUNT);
+
+    // The next save reuses the torn slot, never the good one
+    TEST_ASSERT_TRUE(b.put(1, next));
+    ProbStore c(fs, "/a.bin", "/b.bin");
+    TEST_ASSERT_TRUE(c.load(fillDefaults));
+    TEST_ASSERT_EQUAL_UINT32(3, c.generation());
+    TEST_ASSERT_TRUE(c.get(1, out));
+    TEST_ASSERT_EQUAL_MEMORY(next, out, CHAR_COUNT);
+}
+
+void test_prob_store_loads_image_with_fewer_chars(void) {
+    FS fs(storeDir("grown"));
+    // An image from a build with two characters fewer, P4 learned
+    const uint8_t chars = CHAR_COUNT - 2;
+    uint8_t img[ProbStore::HEADER_LEN + NUM_PROFILES * chars] = {};
+    img[0] = 'M'; img[1] = 'T'; img[2] = 'P'; img[3] = 'S';
+    img[4] = ProbStore::VERSION;
+    img[5] = NUM_PROFILES;
+    img[6] = chars;
+    img[8] = 1u << 4;
+    img[12] = 9;                                 // generation
+    memset(img + ProbStore::HEADER_LEN + 4 * chars, 7, chars);
+    uint32_t crc = ProbStore::crc32(img, 16);
+    crc = ProbStore::crc32(img + ProbStore::HEADER_LEN, sizeof(img) - ProbStore::HEADER_LEN, crc);
+    for (int i = 0; i < 4; i++) img[16 + i] = (uint8_t)(crc >> (8 * i));
+    File f = fs.open("/b.bin", "w");
+    f.write(img, sizeof(img));
+    f.close();
+
+    ProbStore s(fs, "/a.bin", "/b.bin");
+    TEST_ASSERT_TRUE(s.load(fillDefaults));
+    TEST_ASSERT_EQUAL_UINT32(9, s.generation());
+    TEST_ASSERT_EQUAL(1, s.slot());
+    uint8_t out[CHAR_COUNT];
+    TEST_ASSERT_TRUE(s.get(4, out));
+    TEST_ASSERT_EQUAL(7, out[0]);
+    TEST_ASSERT_EQUAL(7, out[chars - 1]);
+    TEST_ASSERT_EQUAL(104, out[CHAR_COUNT - 1]);  // new chars from the defaults
+
+    out[0] = 8;
+    TEST_ASSERT_TRUE(s.put(4, out));             // rewritten at full width, to A
+    TEST_ASSERT_EQUAL(0, s.slot());
+}
+
+// Not a pass/fail check — prints restore time and bytes written per save.
+void test_benchmark_prob_store_restore_and_write_amplification(void) {
+    FS fs(storeDir("bench"));
+    ProbStore s(fs, "/a.bin", "/b.bin");
+    uint8_t probs[CHAR_COUNT];
+    for (uint8_t p = 0; p < NUM_PROFILES; p++) {
+        memset(probs, p + 1, CHAR_COUNT);
+        s.put(p, probs);
+    }
+
+    const int rounds = 2000;
+    fs.bytesRead = 0;
+    fs.opens = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        ProbStore t(fs, "/a.bin", "/b.bin");
+        t.load(fillDefaults);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double us = std::chrono::duration<double, std::micro>(t1 - t0).count() / rounds;
+    TEST_ASSERT_EQUAL_UINT32(2 * rounds, fs.opens);   // one read per slot
+    TEST_ASSERT_EQUAL_UINT32(2u * ProbStore::IMAGE_LEN * rounds, fs.bytesRead);
+
+    // A session's save: the profile plus P0, one slot write
+    fs.bytesWritten = 0;
+    const int saves = 100;
+    for (int r = 0; r < saves; r++) {
+        probs[r % CHAR_COUNT]++;
+        s.putEach((1u << 3) | 1u, probs);
+    }
+    double perSave = (double)fs.bytesWritten / saves;
+    TEST_ASSERT_EQUAL_UINT32(ProbStore::IMAGE_LEN, (uint32_t)perSave);
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "prob store: restore %.1f us (%u bytes read), "
+             "save %.0f bytes for %d learned (%.1fx)",
+             us, 2u * ProbStore::IMAGE_LEN, perSave, CHAR_COUNT, perSave / CHAR_COUNT);
+    TEST_MESSAGE(msg);
+}
+
+// ==========================================
+// Command Table
+// ==========================================
+
+void test_command_lookup_exact_names_only(void) {
+    for (uint8_t i = 0; i < Command::TABLE_LEN; i++) {
+        const Command::Entry* e = Command::find(Command::TABLE[i].name);
+        TEST_ASSERT_NOT_NULL(e);
+        TEST_ASSERT_EQUAL(i, e->id);
+    }
+    TEST_ASSERT_EQUAL(Command::SPEED, Command::find("speed 30", 5)->id);
+    TEST_ASSERT_NULL(Command::find("spee"));
+    TEST_ASSERT_NULL(Command::find("speeds"));
+    TEST_ASSERT_NULL(Command::find(""));
+    TEST_ASSERT_NULL(Command::find("zzz"));
+    TEST_ASSERT_NULL(Command::find("aaa"));
+    TEST_ASSERT_TRUE(Command::find("clock")->via == Command::VIA_WS);
+    TEST_ASSERT_TRUE(Command::find("wifi")->via == Command::VIA_SERIAL);
+}
+
+void test_command_line_args_by_position(void) {
+    char line[] = "  3   30 40  ";
+    Command::LineArgs a(line, "profile speed char_speed");
+    int v;
+    TEST_ASSERT_EQUAL(3, a.count());
+    TEST_ASSERT_TRUE(a.getInt("profile", v)); TEST_ASSERT_EQUAL(3, v);
+    TEST_ASSERT_TRUE(a.getInt("speed", v)); TEST_ASSERT_EQUAL(30, v);
+    TEST_ASSERT_TRUE(a.getInt("char_speed", v)); TEST_ASSERT_EQUAL(40, v);
+    TEST_ASSERT_FALSE(a.has("freq"));
+
+    char partial[] = "5";
+    Command::LineArgs p(partial, "profile speed char_speed");
+    TEST_ASSERT_TRUE(p.has("profile"));
+    TEST_ASSERT_FALSE(p.has("speed"));
+    TEST_ASSERT_FALSE(p.getInt("speed", v));
+
+    // The last parameter takes the rest of the line, spaces included
+    char wifi[] = "sta My Net";
+    Command::LineArgs w(wifi, "mode ssid");
+    TEST_ASSERT_EQUAL_STRING("sta", w.getStr("mode"));
+    TEST_ASSERT_EQUAL_STRING("My Net", w.getStr("ssid"));
+
+    char bad[] = "30x";
+    Command::LineArgs b(bad, "speed");
+    TEST_ASSERT_TRUE(b.has("speed"));
+    TEST_ASSERT_FALSE(b.getInt("speed", v));
+}
+
+void test_command_line_args_bools(void) {
+    bool on = false;
+    char reset[] = "reset";
+    TEST_ASSERT_TRUE(Command::LineArgs(reset, "reset").getBool("reset", on));
+    TEST_ASSERT_TRUE(on);
+    char off[] = "off";
+    TEST_ASSERT_TRUE(Command::LineArgs(off, "on").getBool("on", on));
+    TEST_ASSERT_FALSE(on);
+    char one[] = "1";
+    TEST_ASSERT_TRUE(Command::LineArgs(one, "active").getBool("active", on));
+    TEST_ASSERT_TRUE(on);
+    char junk[] = "maybe";
+    TEST_ASSERT_FALSE(Command::LineArgs(junk, "on").getBool("on", on));
+    char none[] = "";
+    TEST_ASSERT_FALSE(Command::LineArgs(none, "reset").getBool("reset", on));
+}
+
+void test_command_line_buffer_rejects_overflow(void) {
+    Command::LineBuffer<8> line;
+    for (const char* p = "/speed 3"; *p; p++) line.push(*p);
+    TEST_ASSERT_FALSE(line.overflowed());
+    TEST_ASSERT_EQUAL_STRING("/speed 3", line.c_str());
+    line.push('0');
+    TEST_ASSERT_TRUE(line.overflowed());
+    TEST_ASSERT_EQUAL(8, line.length());
+    line.clear();
+    TEST_ASSERT_FALSE(line.overflowed());
+    TEST_ASSERT_EQUAL_STRING("", line.c_str());
+}
+
+// ==========================================
+// Serial Log Buffer
+// ==========================================
+
+// Collects what a drain writes (also the metrics tests' output)
+struct StringOut {
+    std::string s;
+    size_t write(const uint8_t* p, size_t n) { s.append((const char*)p, n); return n; }
+};
+
+void test_log_drains_whole_lines_within_room(void) {
+    LogBuffer<256, 64> log;
+    StringOut out;
+    TEST_ASSERT_TRUE(log.appendf("[OK] %c prob=%u", 'E', 12));   // newline added
+    TEST_ASSERT_TRUE(log.appendf("[SPEED] %u WPM (%s)\n", 27, "up"));
+    TEST_ASSERT_EQUAL(0, log.drain(out, 10));      // first line is 15 bytes
+    TEST_ASSERT_EQUAL(15, log.drain(out, 30));     // not the partial second
+    TEST_ASSERT_EQUAL_STRING("[OK] E prob=12\n", out.s.c_str());
+    TEST_ASSERT_EQUAL(20, log.drain(out, 64));
+    TEST_ASSERT_EQUAL_STRING("[OK] E prob=12\n[SPEED] 27 WPM (up)\n", out.s.c_str());
+    TEST_ASSERT_TRUE(log.empty());
+    TEST_ASSERT_EQUAL(35, log.stats().bytes);
+}
+
+void test_log_drops_whole_lines_when_full_and_wraps(void) {
+    LogBuffer<128, 40> log;
+    StringOut out;
+    const char line[] = "0123456789012345678901234567890\n";   // 32 bytes
+    for (int i = 0; i < 4; i++) TEST_ASSERT_TRUE(log.append(line, 32));
+    TEST_ASSERT_FALSE(log.append(line, 32));
+    TEST_ASSERT_FALSE(log.appendf("x"));
+    TEST_ASSERT_EQUAL(2, log.stats().dropped);
+    TEST_ASSERT_EQUAL(4, log.stats().lines);
+    TEST_ASSERT_EQUAL(128, log.stats().maxUsed);
+
+    // Drain three, refill across the end of the array: two writes out
+    TEST_ASSERT_EQUAL(96, log.drain(out, 100));
+    TEST_ASSERT_TRUE(log.append(line, 32));
+    TEST_ASSERT_TRUE(log.append(line, 32));
+    out = StringOut();
+    TEST_ASSERT_EQUAL(96, log.drain(out, 128));
+    TEST_ASSERT_TRUE(std::string(line) + line + line == out.s);
+
+    // Too long: cut to LINE_MAX, still ending in a newline
+    log.appendf("%s%s", line, line);
+    out = StringOut();
+    log.drain(out, 128);
+    TEST_ASSERT_EQUAL(40, out.s.size());
+    TEST_ASSERT_EQUAL('\n', out.s.back());
+}
+
+void test_benchmark_log_append_when_full(void) {
+    // Cost to the event path of a result line, with the UART keeping up
+    // and with it stalled (every line dropped)
+    LogBuffer<1024, 96> log;
+    StringOut out;
+    const int rounds = 200000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        log.appendf("[ERR] typed=%c expected=%c lat=%d avg=%d prob=%u\n", 'E', 'T', r & 511, 300, 40);
+        if (log.used() > 512) {
+            out.s.clear();
+            log.drain(out, 1024);
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    while (log.appendf("[OK] E prob=12")) {}
+    uint32_t dropped = log.stats().dropped;
+    for (int r = 0; r < rounds; r++) log.appendf("[OK] %c prob=%u", 'E', 12);
+    auto t2 = std::chrono::steady_clock::now();
+    TEST_ASSERT_EQUAL_UINT32(dropped + rounds, log.stats().dropped);
+
+    auto ns = [rounds](std::chrono::steady_clock::time_point a,
+                        std::chrono::steady_clock::time_point b) {
+        return std::chrono::duration<double, std::nano>(b - a).count() / rounds;
+    };
+    char msg[128];
+    snprintf(msg, sizeof(msg), "serial log: append %.1f ns/line draining, %.1f ns/line dropped",
+             ns(t0, t1), ns(t1, t2));
+    TEST_MESSAGE(msg);
+}
+
+// ==========================================
+// Metrics
+// ==========================================
+
+static int32_t readSeven() { return 7; }
+
+void test_metrics_render_prometheus_text(void) {
+    Metrics::Registry<4> reg;
+    Metrics::Counter c;
+    Metrics::Gauge g;
+    LogHistogram h;
+    c.inc(3);
+    g.set(-2);
+    h.record(0);
+    h.record(5);
+    h.record(6);
+    TEST_ASSERT_TRUE(reg.counter("x_total", "X", &c));
+    TEST_ASSERT_TRUE(reg.gauge("q", "Q", &g, "sink=\"a\""));
+    TEST_ASSERT_TRUE(reg.gauge("q", "Q", readSeven, "sink=\"b\""));
+    TEST_ASSERT_TRUE(reg.histogram("t_us", "T", &h));
+    TEST_ASSERT_FALSE(reg.counter("full", "F", &c));
+
+    StringOut out;
+    reg.render(out);
+    const char* expected =
+        "# HELP x_total X\n# TYPE x_total counter\nx_total 3\n"
+        "# HELP q Q\n# TYPE q gauge\nq{sink=\"a\"} -2\nq{sink=\"b\"} 7\n"
+        "# HELP t_us T\n# TYPE t_us histogram\n"
+        "t_us_bucket{le=\"0\"} 1\nt_us_bucket{le=\"1\"} 1\n"
+        "t_us_bucket{le=\"3\"} 1\nt_us_bucket{le=\"7\"} 3\n"
+        "t_us_bucket{le=\"+Inf\"} 3\nt_us_sum 11\nt_us_count 3\n";
+    TEST_ASSERT_EQUAL_STRING(expected, out.s.c_str());
+}
+
+void test_metrics_rate_per_second(void) {
+    Metrics::Rate r;
+    r.update(500, 10);       // under a second: unchanged
+    TEST_ASSERT_EQUAL_INT32(0, r.value());
+    r.update(2000, 50);
+    TEST_ASSERT_EQUAL_INT32(25, r.value());
+    r.update(2500, 80);
+    TEST_ASSERT_EQUAL_INT32(25, r.value());
+}
+
+// ==========================================
+// WebSocket Binary Protocol
+// ==========================================
+
+void test_ws_char_sent_frame(void) {
+    TrainerEvent evt;
+    evt.type = TrainerEvent::CHAR_SENT;
+    evt.sent.ch = 'K';
+    evt.sent.code = morseCodeFor('K');
+    evt.sent.queueDist = 2;
+    evt.sent.durationUs = 216000;
+    uint8_t f[WsProtocol::MAX_FRAME];
+    TEST_ASSERT_EQUAL(8, WsProtocol::encode(evt, f));
+    TEST_ASSERT_EQUAL(WsProtocol::TAG_CHAR_SENT, f[0]);
+    TEST_ASSERT_EQUAL('K', f[1]);
+    TEST_ASSERT_EQUAL(3, f[2]);
+    TEST_ASSERT_EQUAL(0x05, f[3]);   // -.-
+    TEST_ASSERT_EQUAL(2, f[4]);
+    TEST_ASSERT_EQUAL_UINT32(216000, f[5] | (f[6] << 8) | ((uint32_t)f[7] << 16));
+}
+
+void test_ws_result_frame_flags_and_saturation(void) {
+    TrainerEvent evt;
+    evt.type = TrainerEvent::RESULT;
+    evt.result.correct = false;
+    evt.result.typed = 'E';
+    evt.result.expected = 'I';
+    evt.result.prob = 95;
+    evt.result.latencyMs = 70000;     // saturates
+    evt.result.latencyAvgMs = 380;
+    uint8_t f[WsProtocol::MAX_FRAME];
+    TEST_ASSERT_EQUAL(8, WsProtocol::encode(evt, f));
+    TEST_ASSERT_EQUAL(WsProtocol::TAG_RESULT | WsProtocol::FLAG_LATENCY, f[0]);
+    TEST_ASSERT_EQUAL('E', f[1]);
+    TEST_ASSERT_EQUAL('I', f[2]);
+    TEST_ASSERT_EQUAL(95, f[3]);
+    TEST_ASSERT_EQUAL(0xFFFF, f[4] | (f[5] << 8));
+    TEST_ASSERT_EQUAL(380, f[6] | (f[7] << 8));
+
+    evt.result.correct = true;
+    evt.result.latencyMs = -1;        // not measured
+    WsProtocol::encode(evt, f);
+    TEST_ASSERT_EQUAL(WsProtocol::TAG_RESULT | WsProtocol::FLAG_CORRECT, f[0]);
+}
+
+void test_ws_state_frames(void) {
+    TrainerEvent evt;
+    uint8_t f[WsProtocol::MAX_FRAME];
+    evt.type = TrainerEvent::SPEED_CHANGE;
+    evt.state.speed = 27;
+    evt.state.ditUs = 222222;
+    evt.state.direction = "down";
+    TEST_ASSERT_EQUAL(5, WsProtocol::encode(evt, f));
+    TEST_ASSERT_EQUAL(WsProtocol::TAG_SPEED_CHANGE | WsProtocol::FLAG_DIR_DOWN, f[0]);
+    TEST_ASSERT_EQUAL(27, f[1]);
+    TEST_ASSERT_EQUAL_UINT32(222222, f[2] | (f[3] << 8) | ((uint32_t)f[4] << 16));
+
+    evt.type = TrainerEvent::SESSION_STATE;
+    evt.state.running = true;
+    evt.state.charSpeed = 50;
+    TEST_ASSERT_EQUAL(6, WsProtocol::encode(evt, f));
+    TEST_ASSERT_EQUAL(WsProtocol::TAG_SESSION | WsProtocol::FLAG_RUNNING, f[0]);
+    TEST_ASSERT_EQUAL(50, f[2]);
+
+    evt.type = TrainerEvent::CONTEXT_LOST;
+    TEST_ASSERT_EQUAL(5, WsProtocol::encode(evt, f));
+    TEST_ASSERT_EQUAL(WsProtocol::TAG_CONTEXT_LOST, f[0]);
+}
+
+void test_ws_char_start_frame(void) {
+    TrainerEvent evt;
+    evt.type = TrainerEvent::CHAR_START;
+    evt.tone.ch = 'Q';
+    evt.tone.code = morseCodeFor('Q');
+    evt.tone.startUs = 0xF1234567;    // micros() near wraparound
+    evt.tone.ditUs = 48000;
+    evt.tone.gapUs = 144000;
+    uint8_t f[WsProtocol::MAX_FRAME];
+    TEST_ASSERT_EQUAL(14, WsProtocol::encode(evt, f));
+    TEST_ASSERT_EQUAL(14, WsProtocol::recordLen(f[0]));
+    TEST_ASSERT_EQUAL(WsProtocol::TAG_CHAR_START, f[0]);
+    TEST_ASSERT_EQUAL('Q', f[1]);
+    TEST_ASSERT_EQUAL(4, f[2]);
+    TEST_ASSERT_EQUAL(0x0D, f[3]);   // --.-
+    TEST_ASSERT_EQUAL_UINT32(0xF1234567, f[4] | (f[5] << 8) | ((uint32_t)f[6] << 16) | ((uint32_t)f[7] << 24));
+    TEST_ASSERT_EQUAL_UINT32(48000, f[8] | (f[9] << 8) | ((uint32_t)f[10] << 16));
+    TEST_ASSERT_EQUAL_UINT32(144000, f[11] | (f[12] << 8) | ((uint32_t)f[13] << 16));
+}
+
+void test_ws_batched_records_split_by_tag(void) {
+    // Records for every event type back to back, as a batch frame
+    uint8_t frame[TrainerEvent::TYPE_COUNT * WsProtocol::MAX_FRAME];
+    size_t len = 0;
+    for (uint8_t t = 0; t < TrainerEvent::TYPE_COUNT; t++) {
+        TrainerEvent evt;
+        memset(&evt, 0, sizeof(evt));
+        evt.type = (TrainerEvent::Type)t;
+        len += WsProtocol::encode(evt, frame + len);
+    }
+    size_t off = 0;
+    uint8_t records = 0;
+    while (off < len) {
+        uint8_t n = WsProtocol::recordLen(frame[off]);
+        TEST_ASSERT_TRUE(n > 0);
+        TEST_ASSERT_EQUAL(records + 1, frame[off] & 0x0F);
+        off += n;
+        records++;
+    }
+    TEST_ASSERT_EQUAL(len, off);
+    TEST_ASSERT_EQUAL(TrainerEvent::TYPE_COUNT, records);
+    TEST_ASSERT_EQUAL(0, WsProtocol::recordLen(0x0F));
+
+    // A SEQ record closes the frame
+    uint8_t seq[WsProtocol::SEQ_LEN];
+    TEST_ASSERT_EQUAL(WsProtocol::SEQ_LEN, WsProtocol::encodeSeq(0x01020304, seq));
+    TEST_ASSERT_EQUAL(WsProtocol::SEQ_LEN, WsProtocol::recordLen(seq[0]));
+    TEST_ASSERT_EQUAL(WsProtocol::TAG_SEQ, seq[0]);
+    TEST_ASSERT_EQUAL(0x04, seq[1]);
+    TEST_ASSERT_EQUAL(0x01, seq[4]);
+}
+
 // ==========================================
 // Test Runner
 // ==========================================
@@ -270,6 +1692,16 @@ int main(int argc, char** argv) {
     RUN_TEST(test_decode_dash);
     RUN_TEST(test_decode_dot_dash);
 
+    // Packed code tables
+    RUN_TEST(test_encode_matches_legacy_scan);
+    RUN_TEST(test_decode_matches_legacy_for_every_code);
+    RUN_TEST(test_code_for_known_chars);
+    RUN_TEST(test_char_for_rejects_malformed_code);
+    RUN_TEST(test_code_append_builds_keyed_pattern);
+    RUN_TEST(test_code_append_stops_at_max_elements);
+    RUN_TEST(test_code_to_string_renders_space_and_unknown);
+    RUN_TEST(test_benchmark_encode_decode_tables);
+
     // Profiles
     RUN_TEST(test_profile_P1_all_letters_nonzero);
     RUN_TEST(test_profile_P1_punctuation_zero);
@@ -280,5 +1712,92 @@ int main(int argc, char** argv) {
     RUN_TEST(test_profile_probabilities_in_range);
     RUN_TEST(test_profile_each_has_at_least_one_nonzero);
 
+    // Log histogram
+    RUN_TEST(test_histogram_bucket_boundaries);
+    RUN_TEST(test_histogram_percentiles);
+    RUN_TEST(test_histogram_reset_clears_everything);
+
+    // PARIS timing model
+    RUN_TEST(test_timing_paris_word_is_60_over_wpm);
+    RUN_TEST(test_timing_units_match_paris);
+    RUN_TEST(test_timing_farnsworth_word_at_effective_speed);
+    RUN_TEST(test_timing_farnsworth_off_when_not_slower);
+
+    // Weighted sampler / PRNG
+    RUN_TEST(test_sampler_matches_linear_scan);
+    RUN_TEST(test_sampler_incremental_updates_match_rebuild);
+    RUN_TEST(test_sampler_skips_zero_weights_and_empty);
+    RUN_TEST(test_rng_seeded_and_in_range);
+    RUN_TEST(test_benchmark_sampler_vs_scan);
+
+    // Confusion matrix
+    RUN_TEST(test_confusion_records_ordered_pairs);
+    RUN_TEST(test_confusion_ignores_same_and_out_of_range);
+    RUN_TEST(test_confusion_saturates);
+    RUN_TEST(test_confusion_top_sorted);
+    RUN_TEST(test_confusion_ages_when_full);
+    RUN_TEST(test_confusion_raw_roundtrip);
+
+    // Input aligner
+    RUN_TEST(test_align_exact_and_substitution);
+    RUN_TEST(test_align_missed_char_resyncs);
+    RUN_TEST(test_align_extra_char_resyncs);
+    RUN_TEST(test_align_cost_counts_edits);
+    RUN_TEST(test_align_step_scores_each_sent_char_once);
+
+    // Ring buffer
+    RUN_TEST(test_ring_fifo_wraps_slots);
+    RUN_TEST(test_ring_full_rejects_push);
+    RUN_TEST(test_ring_lookahead_and_lookbehind);
+    RUN_TEST(test_ring_sequence_numbers_wrap_16_bits);
+
+    // Event bus
+    RUN_TEST(test_bus_fans_out_within_budget);
+    RUN_TEST(test_bus_drop_policies_count_losses);
+    RUN_TEST(test_bus_coalesce_keeps_latest_per_type);
+    RUN_TEST(test_bus_waits_for_ready_sink);
+
+    // Event log
+    RUN_TEST(test_log_numbers_and_overwrites_oldest);
+    RUN_TEST(test_log_lookup_past_16_bit_ring_wrap);
+
+    // Boot timer
+    RUN_TEST(test_boot_phases_chain_and_background);
+
+    // Write-behind
+    RUN_TEST(test_write_behind_coalesces_until_quiet_and_idle);
+
+    // Session journal
+    RUN_TEST(test_journal_record_round_trip_and_saturation);
+    RUN_TEST(test_journal_csv_sessions_and_quoting);
+
+    // Probability store
+    RUN_TEST(test_prob_store_round_trip_per_profile);
+    RUN_TEST(test_prob_store_survives_power_cut_mid_save);
+    RUN_TEST(test_prob_store_loads_image_with_fewer_chars);
+    RUN_TEST(test_benchmark_prob_store_restore_and_write_amplification);
+
+    // Command table
+    RUN_TEST(test_command_lookup_exact_names_only);
+    RUN_TEST(test_command_line_args_by_position);
+    RUN_TEST(test_command_line_args_bools);
+    RUN_TEST(test_command_line_buffer_rejects_overflow);
+
+    // Serial log buffer
+    RUN_TEST(test_log_drains_whole_lines_within_room);
+    RUN_TEST(test_log_drops_whole_lines_when_full_and_wraps);
+    RUN_TEST(test_benchmark_log_append_when_full);
+
+    // Metrics
+    RUN_TEST(test_metrics_render_prometheus_text);
+    RUN_TEST(test_metrics_rate_per_second);
+
+    // WebSocket binary protocol
+    RUN_TEST(test_ws_char_sent_frame);
+    RUN_TEST(test_ws_result_frame_flags_and_saturation);
+    RUN_TEST(test_ws_state_frames);
+    RUN_TEST(test_ws_char_start_frame);
+    RUN_TEST(test_ws_batched_records_split_by_tag);
+
     return UNITY_END();
 }
@@ -0,0 +1,34 @@
+package morsetrainer;
+
+/**
+ * Port of the firmware's PARIS timing model (include/morse_timing.h).
+ * Speeds are in the device's unit (characters per minute, shown as WPM),
+ * so one dit is 6,000,000 / speed microseconds and a PARIS word lasts
+ * exactly 60 / (speed / 5) seconds.
+ */
+final class MorseTiming {
+
+    static final int PARIS_UNITS = 50;
+    static final int CHARS_PER_WORD = 5;
+    static final long US_PER_MINUTE = 60_000_000L;
+
+    static final int DAH_UNITS = 3;
+    static final int ELEMENT_GAP_UNITS = 1;
+
+    private MorseTiming() {
+    }
+
+    /** One dit in microseconds, rounded. */
+    static long ditUs(int speed) {
+        long den = (long) PARIS_UNITS * speed;
+        return (US_PER_MINUTE * CHARS_PER_WORD + den / 2) / den;
+    }
+
+    static long dahUs(int speed) {
+        return DAH_UNITS * ditUs(speed);
+    }
+
+    static long elementGapUs(int speed) {
+        return ELEMENT_GAP_UNITS * ditUs(speed);
+    }
+}
@@ -6,7 +6,8 @@ import java.util.concurrent.LinkedBlockingQueue;
 
 /**
  * Generates CW sidetone through laptop speakers.
- * Plays morse patterns (e.g. ".-" for A) with proper timing based on WPM.
+ * Plays morse patterns (e.g. ".-" for A) with the firmware's PARIS timing
+ * (see {@link MorseTiming}).
  * Continuous phase tracking and raised-cosine ramp for a clean, smooth tone.
  */
 public class ToneGenerator {
@@ -86,33 +87,38 @@ public class ToneGenerator {
     }
 
     private void playPattern(String pattern, int wpm) {
-        int ditMs = 1200 / wpm;
+        long ditUs = MorseTiming.ditUs(wpm);
+        long dahUs = MorseTiming.dahUs(wpm);
+        long gapUs = MorseTiming.elementGapUs(wpm) * spacingPct / 100;
         int freq = freqHz; // snapshot for this pattern
 
         for (int i = 0; i < pattern.length(); i++) {
             char element = pattern.charAt(i);
-            int durationMs;
+            long durationUs;
             if (element == '.') {
-                durationMs = ditMs;
+                durationUs = ditUs;
             } else if (element == '-') {
-                durationMs = ditMs * 3;
+                durationUs = dahUs;
             } else {
                 continue;
             }
 
-            writeTone(durationMs, freq);
+            writeTone(durationUs, freq);
 
             if (i < pattern.length() - 1) {
-                int gapMs = ditMs * spacingPct / 100;
-                writeSilence(Math.max(gapMs, 1));
+                writeSilence(Math.max(gapUs, 1000));
             }
         }
 
         line.drain();
     }
 
-    private void writeTone(int durationMs, int freq) {
-        int numSamples = (int) (SAMPLE_RATE * durationMs / 1000.0);
+    private static int samplesFor(long durationUs) {
+        return (int) ((SAMPLE_RATE * durationUs + 500_000L) / 1_000_000L);
+    }
+
+    private void writeTone(long durationUs, int freq) {
+        int numSamples = samplesFor(durationUs);
         int rampSamples = (int) (SAMPLE_RATE * RAMP_MS / 1000.0);
         rampSamples = Math.min(rampSamples, numSamples / 2);
         byte[] buf = new byte[numSamples * 2];
@@ -141,8 +147,8 @@ public class ToneGenerator {
         line.write(buf, 0, buf.length);
     }
 
-    private void writeSilence(int durationMs) {
-        int numSamples = (int) (SAMPLE_RATE * durationMs / 1000.0);
+    private void writeSilence(long durationUs) {
+        int numSamples = samplesFor(durationUs);
         byte[] buf = new byte[numSamples * 2];
         line.write(buf, 0, buf.length);
     }
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""
+Embed the web UI (data/) into the firmware as gzipped PROGMEM blobs.
+
+Each asset is minified (conservatively: comments, indentation and blank
+lines only), gzipped and written to include/web_assets.h together with a
+strong ETag derived from its content. index.html references the other
+assets as name?v=<hash>, so those can be cached as immutable while
+index.html itself is revalidated (304) on every load.
+
+Runs automatically before every PlatformIO build (extra_scripts in
+platformio.ini). Arduino IDE users: run it by hand after editing data/.
+The header is only rewritten when its content changes.
+
+Usage: python tools/embed_web_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    PROJ_ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJ_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+DATA_DIR = os.path.join(PROJ_ROOT, "data")
+OUT_FILE = os.path.join(PROJ_ROOT, "include", "web_assets.h")
+
+# (file, content type); index.html last so it can reference the hashes
+ASSETS = [
+    ("style.css", "text/css"),
+    ("app.js", "application/javascript"),
+    ("index.html", "text/html"),
+]
+
+
+def minify_js(text):
+    lines = []
+    for line in text.splitlines():
+        s = line.strip()
+        if not s or s.startswith("//"):
+            continue
+        lines.append(s)
+    return "\n".join(lines) + "\n"
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    lines = [line.strip() for line in text.splitlines()]
+    text = "\n".join(line for line in lines if line)
+    return re.sub(r"\s*([{};])\s*", r"\1", text) + "\n"
+
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    lines = [line.strip() for line in text.splitlines()]
+    return "\n".join(line for line in lines if line) + "\n"
+
+
+MINIFIERS = {
+    ".js": minify_js,
+    ".css": minify_css,
+    ".html": minify_html,
+}
+
+
+def symbol_for(name):
+    return re.sub(r"[^A-Za-z0-9]", "_", name).upper() + "_GZ"
+
+
+def c_bytes(data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(rows)
+
+
+def build():
+    hashes = {}
+    blobs = []
+    for name, ctype in ASSETS:
+        with open(os.path.join(DATA_DIR, name), "r", encoding="utf-8") as f:
+            text = f.read()
+        text = MINIFIERS[os.path.splitext(name)[1]](text)
+
+        if name == "index.html":
+            # Point at the content-hashed URLs of the other assets
+            for other, h in hashes.items():
+                text = re.sub(r'((?:href|src)=")%s(")' % re.escape(other),
+                              r"\g<1>%s?v=%s\g<2>" % (other, h), text)
+
+        raw = text.encode("utf-8")
+        digest = hashlib.sha256(raw).hexdigest()[:16]
+        hashes[name] = digest
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        blobs.append((name, ctype, digest, gz, len(raw)))
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Generated by tools/embed_web_assets.py from data/ - do not edit.")
+    out.append("// Gzipped web UI served from flash (see web_server.cpp).")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("namespace WebAssets {")
+    out.append("")
+    out.append("struct Asset {")
+    out.append("    const char* path;")
+    out.append("    const char* type;")
+    out.append("    const char* etag;       // strong, quoted")
+    out.append("    bool immutable;         // URL carries the content hash")
+    out.append("    const uint8_t* gz;      // PROGMEM")
+    out.append("    uint32_t len;")
+    out.append("};")
+    out.append("")
+    for name, ctype, digest, gz, rawLen in blobs:
+        out.append("// %s: %d bytes minified, %d gzipped" % (name, rawLen, len(gz)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % symbol_for(name))
+        out.append(c_bytes(gz))
+        out.append("};")
+        out.append("")
+    out.append("static const Asset ASSETS[] = {")
+    for name, ctype, digest, gz, rawLen in blobs:
+        immutable = "false" if name == "index.html" else "true"
+        out.append('    { "/%s", "%s", "\\"%s\\"", %s, %s, sizeof(%s) },'
+                   % (name, ctype, digest, immutable, symbol_for(name), symbol_for(name)))
+    out.append("};")
+    out.append("")
+    out.append("static const uint8_t ASSET_COUNT = sizeof(ASSETS) / sizeof(ASSETS[0]);")
+    out.append("")
+    out.append("} // namespace WebAssets")
+    content = "\n".join(out) + "\n"
+
+    old = None
+    if os.path.exists(OUT_FILE):
+        with open(OUT_FILE, "r", encoding="utf-8") as f:
+            old = f.read()
+    if old != content:
+        with open(OUT_FILE, "w", encoding="utf-8", newline="\n") as f:
+            f.write(content)
+        print("embed_web_assets: wrote %s" % os.path.relpath(OUT_FILE, PROJ_ROOT))
+    for name, ctype, digest, gz, rawLen in blobs:
+        print("embed_web_assets: %-10s %6d -> %5d bytes  %s" % (name, rawLen, len(gz), digest))
+
+
+build()